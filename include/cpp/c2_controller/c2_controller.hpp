@@ -14,12 +14,22 @@ public:
     ~C2Controller();
     
     void setMessageGateway(gateway::MessageGateway* gateway);
-    void processTracks(const std::vector<Track>& tracks);
+    // Scoring policy from the registry (threat_policy.hpp)
+    void setThreatPolicy(const ThreatPolicy& policy) { evaluator_ = ThreatEvaluator(policy); }
+    const ThreatPolicy& getThreatPolicy() const { return evaluator_.getPolicy(); }
+    
+    // Per-cycle scratch for processTracks (null: heap). The arena must
+    // outlive the cycle and be reset by the caller.
+    void setCycleArena(common::CycleArena* arena) { arena_ = arena; }
+    void processTracks(TrackSpan tracks);
     void assignTarget(const Track& track);
+    // Assign with a score already computed for `track` (e.g. by the ranking)
+    void assignTarget(const Track& track, const ThreatEvaluator::ThreatScore& score);
 
 private:
     ThreatEvaluator evaluator_;
     gateway::MessageGateway* gateway_;
+    common::CycleArena* arena_;
 };
 
 } // namespace c2
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include <cstddef>
+
+namespace skyguardis {
+namespace c2 {
+
+// Closest point of approach (CPA) of a track to the radar, assuming it
+// holds its speed and heading in level flight (as common::toEnu does).
+struct ClosestApproach {
+    double miss_distance_m;    // Range at the closest point; current range once past it
+    double time_to_go_s;       // Until the closest point; 0 once past it
+    double closing_speed_ms;   // Rate the range shrinks at; negative while receding
+};
+ClosestApproach closestApproach(const Track& track);
+
+// Batch closestApproach() over columnar arrays of `count` tracks, within
+// floating point rounding of the scalar function. Runs on the instruction
+// set selected by common::getKernelIsa().
+void closestApproachBatch(const double* range_m, const double* azimuth_rad,
+                          const double* elevation_rad, const double* velocity_ms,
+                          const double* heading_rad, double* miss_distance_m,
+                          double* time_to_go_s, double* closing_speed_ms, size_t count);
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skyguardis {
+namespace c2 {
+
+// Marks a track left without a plot by PlotAssociator
+static constexpr uint32_t NO_PLOT = UINT32_MAX;
+
+// ENU positions with their 3x3 covariances, stored column-wise.
+// Covariance columns hold the upper triangle: ee, en, eu, nn, nu, uu.
+struct PositionSet {
+    std::vector<double> east_m;
+    std::vector<double> north_m;
+    std::vector<double> up_m;
+    std::vector<double> covariance[6];
+
+    size_t size() const { return east_m.size(); }
+    void resize(size_t count);
+    void set(size_t index, const double (&position)[3], const double (&matrix)[3][3]);
+};
+
+struct AssociatorConfig {
+    double gate_chi2;         // Mahalanobis gate (chi-square, 3 dof); also the cost of a miss
+    double cell_size_m;       // Edge length of the grid cells
+    double auction_epsilon;   // Minimum bid; total cost ends within tracks * epsilon of optimal
+
+    AssociatorConfig() : gate_chi2(16.27),   // 99.9% of true plots
+                         cell_size_m(1000.0),
+                         auction_epsilon(0.01) {}
+};
+
+// Work done by the last associate() call
+struct AssociationStats {
+    size_t gated_pairs;           // Track/plot pairs inside the gate
+    size_t bids;                  // Auction bids on plots
+    size_t assigned;              // Tracks that received a plot
+
+    AssociationStats() : gated_pairs(0), bids(0), assigned(0) {}
+};
+
+// Global nearest-neighbour association of plots to predicted tracks.
+// Plots are binned into a uniform grid of hashed cells (counting sort, no
+// per-cell allocation), so each track only tests the plots in the cells
+// its gate can reach. A pair passes the gate when the squared Mahalanobis
+// distance under S = P_track + R_plot is at most gate_chi2. The gated
+// pairs form a sparse assignment problem - minimise the summed distances,
+// with a miss costing gate_chi2 - solved by a forward auction.
+class PlotAssociator {
+public:
+    PlotAssociator();
+    explicit PlotAssociator(const AssociatorConfig& config);
+
+    void setConfig(const AssociatorConfig& config);
+    const AssociatorConfig& getConfig() const { return config_; }
+
+    // plot_for_track[t] receives the plot assigned to track t, or NO_PLOT.
+    // Each plot is assigned to at most one track.
+    void associate(const PositionSet& tracks, const PositionSet& plots,
+                   std::vector<uint32_t>& plot_for_track);
+
+    const AssociationStats& getStats() const { return stats_; }
+
+private:
+    AssociatorConfig config_;
+    AssociationStats stats_;
+
+    // Grid: plot indices sorted by hashed cell; bucket b owns
+    // cell_plots_[cell_start_[b] .. cell_start_[b + 1])
+    std::vector<uint32_t> cell_start_;
+    std::vector<uint32_t> cell_plots_;
+    std::vector<uint32_t> plot_bucket_;
+    size_t bucket_mask_;
+    double max_plot_variance_m2_;   // Largest plot covariance trace
+
+    // Gated pairs, grouped by track: track t owns arcs [arc_start_[t], arc_start_[t + 1])
+    std::vector<uint32_t> arc_start_;
+    std::vector<uint32_t> arc_plot_;
+    std::vector<double> arc_benefit_;  // gate_chi2 - distance; a miss is worth 0
+    std::vector<uint32_t> visit_stamp_;
+
+    // Auction state
+    std::vector<double> price_;
+    std::vector<uint32_t> owner_;
+    std::vector<uint32_t> unassigned_;
+
+    void buildGrid(const PositionSet& plots);
+    void gate(const PositionSet& tracks, const PositionSet& plots);
+    void auction(size_t track_count, size_t plot_count, std::vector<uint32_t>& plot_for_track);
+};
+
+} // namespace c2
+} // namespace skyguardis
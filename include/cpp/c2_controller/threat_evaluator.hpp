@@ -1,5 +1,7 @@
 #pragma once
 
+#include "common/cycle_arena.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -15,19 +17,102 @@ struct Track {
     double heading_rad;
 };
 
+// Track id carried by a false alarm (simulated track ids start at 1)
+static constexpr uint32_t FALSE_ALARM_ID = 0;
+
+// Radar plot: one noisy position measurement of a track
+struct Measurement {
+    uint32_t track_id;            // Reporting track, or FALSE_ALARM_ID
+    double range_m;
+    double azimuth_rad;
+    double elevation_rad;
+};
+
+// Non-owning, read-only view of a contiguous array of tracks.
+// Converts implicitly from std::vector<Track> so callers holding a vector
+// keep working; snapshot and replay sources pass their buffers directly.
+class TrackSpan {
+public:
+    TrackSpan() : data_(nullptr), size_(0) {}
+    TrackSpan(const Track* data, size_t size) : data_(data), size_(size) {}
+    TrackSpan(const std::vector<Track>& tracks) : data_(tracks.data()), size_(tracks.size()) {}
+    
+    const Track* begin() const { return data_; }
+    const Track* end() const { return data_ + size_; }
+    const Track* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const Track& operator[](size_t index) const { return data_[index]; }
+
+private:
+    const Track* data_;
+    size_t size_;
+};
+
+// Columnar view of `count` tracks: the kinematics threat models read, one
+// array per field (same units as Track). Non-owning.
+struct TrackColumns {
+    const double* range_m;
+    const double* azimuth_rad;
+    const double* elevation_rad;
+    const double* velocity_ms;
+    const double* heading_rad;
+    size_t count;
+};
+
+// Registered scoring policy (see threat_policy.hpp)
+struct ThreatPolicy;
+
+// Scores and ranks tracks with a scoring policy picked at run time. Each
+// call is dispatched once to the policy's compiled-in loops, so nothing is
+// called through a pointer per track.
 class ThreatEvaluator {
 public:
+    // track_index of a score that was not ranked from a TrackSpan
+    static constexpr uint32_t NO_TRACK_INDEX = UINT32_MAX;
+    
     struct ThreatScore {
         uint32_t track_id;
+        uint32_t track_index;   // Position in the ranked TrackSpan, or NO_TRACK_INDEX
         double score;
         uint8_t priority;
     };
 
+    // The default (first registered) policy
+    ThreatEvaluator();
+    explicit ThreatEvaluator(const ThreatPolicy& policy);
+    
+    const ThreatPolicy& getPolicy() const { return *policy_; }
+    
+    // Score of one track (track_index = NO_TRACK_INDEX)
     ThreatScore evaluate(const Track& track) const;
-    std::vector<ThreatScore> prioritize(const std::vector<Track>& tracks) const;
+    
+    // Every track, highest threat first. Each score carries the index of
+    // its track in `tracks`, so callers reach the track without a search.
+    std::vector<ThreatScore> prioritize(TrackSpan tracks) const;
+    
+    // Same ranking into `scores`, which allocates from its cycle arena
+    void prioritize(TrackSpan tracks, common::ArenaVector<ThreatScore>& scores) const;
+    
+    // The `k` highest threats, best first: the first k entries of
+    // prioritize() without sorting the rest. One pass over the tracks with
+    // a k-entry heap, so O(n log k) time and O(k) memory.
+    void topK(TrackSpan tracks, size_t k, std::vector<ThreatScore>& scores) const;
+    void topK(TrackSpan tracks, size_t k, common::ArenaVector<ThreatScore>& scores) const;
+    
+    // Scores of `tracks.count` tracks into `scores`, 2 or 4 tracks per
+    // instruction with the instruction set selected for the batch kernels
+    // (common::getKernelIsa()). Matches evaluate().score to within
+    // rounding (bit for bit for the range policy).
+    void scoreBatch(const TrackColumns& tracks, double* scores) const;
+    
+    // Ranking order: higher score first, ties broken by lower track id
+    static bool ranksHigher(const ThreatScore& a, const ThreatScore& b) {
+        return a.score > b.score || (a.score == b.score && a.track_id < b.track_id);
+    }
 
 private:
-    double computeThreatScore(const Track& track) const;
+    const ThreatPolicy* policy_;
 };
 
 } // namespace c2
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "common/cycle_arena.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skyguardis {
+namespace c2 {
+
+// Threat scoring policies
+//
+// A policy is a struct of static members. PolicyEvaluator is instantiated
+// on it, so the formula is inlined into the per-track and SIMD batch loops:
+//   NAME, DESCRIPTION   registry key (c2_node --threat-model) and help text
+//   score(track)        score of one track
+//   scoreLanes<V>()     score of the sizeof(V) / sizeof(double) tracks at
+//                       row i of a block (V = double or a vector of lanes)
+//   Block, prepare()    values derived in bulk for a block of at most
+//                       THREAT_SCORE_BLOCK tracks before scoreLanes() runs
+//   priority(score)     0-255 priority sent with a target assignment
+//   BULK_RANKING        rank a TrackSpan by gathering blocks of tracks into
+//                       columns; pays off when scoring is expensive
+// ThreatPolicyDefaults provides Block, prepare(), priority() and
+// BULK_RANKING for policies that need nothing special.
+//
+// Adding a policy: declare it here, define its members, instantiate
+// PolicyEvaluator on it and add a registry row in threat_policy.cpp.
+
+constexpr size_t THREAT_SCORE_BLOCK = 256;
+
+struct ThreatPolicyDefaults {
+    static constexpr bool BULK_RANKING = false;
+    struct Block {};
+    static void prepare(const TrackColumns&, Block&) {}
+    static uint8_t priority(double score) {
+        return static_cast<uint8_t>(std::min(255.0, score * 10.0));
+    }
+};
+
+// Closer and faster = higher threat
+struct RangeSpeedPolicy : ThreatPolicyDefaults {
+    static constexpr const char* NAME = "range";
+    static constexpr const char* DESCRIPTION = "closer and faster = higher threat";
+
+    static double score(const Track& track);
+    template <typename V>
+    static void scoreLanes(V& score, const TrackColumns& tracks, const Block& block, size_t i);
+};
+
+// Closer, sooner and faster at the closest point of approach to the radar
+// (c2::closestApproach); tracks flying away score nothing
+struct ClosestApproachPolicy : ThreatPolicyDefaults {
+    static constexpr const char* NAME = "cpa";
+    static constexpr const char* DESCRIPTION = "miss distance, time to go and closing speed";
+    static constexpr bool BULK_RANKING = true;
+
+    struct Block {
+        double miss_distance_m[THREAT_SCORE_BLOCK];
+        double time_to_go_s[THREAT_SCORE_BLOCK];
+        double closing_speed_ms[THREAT_SCORE_BLOCK];
+    };
+    static void prepare(const TrackColumns& tracks, Block& block);
+
+    static double score(const Track& track);
+    template <typename V>
+    static void scoreLanes(V& score, const TrackColumns& tracks, const Block& block, size_t i);
+};
+
+// ThreatEvaluator operations with the policy compiled in. Same semantics
+// as the ThreatEvaluator members of the same names.
+template <typename Policy>
+class PolicyEvaluator {
+public:
+    using ThreatScore = ThreatEvaluator::ThreatScore;
+
+    static ThreatScore evaluate(const Track& track);
+    static void scoreBatch(const TrackColumns& tracks, double* scores);
+    static void prioritize(TrackSpan tracks, std::vector<ThreatScore>& scores);
+    static void prioritize(TrackSpan tracks, common::ArenaVector<ThreatScore>& scores);
+    static void topK(TrackSpan tracks, size_t k, std::vector<ThreatScore>& scores);
+    static void topK(TrackSpan tracks, size_t k, common::ArenaVector<ThreatScore>& scores);
+
+private:
+    template <typename Visit>
+    static void forEachScore(TrackSpan tracks, Visit visit);
+    template <typename Scores>
+    static void rank(TrackSpan tracks, Scores& scores);
+    template <typename Scores>
+    static void selectTop(TrackSpan tracks, size_t k, Scores& scores);
+};
+
+extern template class PolicyEvaluator<RangeSpeedPolicy>;
+extern template class PolicyEvaluator<ClosestApproachPolicy>;
+
+// Registry row: one PolicyEvaluator instantiation behind plain function
+// pointers, so the policy is picked by name at startup
+struct ThreatPolicy {
+    using ThreatScore = ThreatEvaluator::ThreatScore;
+
+    const char* name;
+    const char* description;
+    ThreatScore (*evaluate)(const Track& track);
+    void (*scoreBatch)(const TrackColumns& tracks, double* scores);
+    void (*prioritize)(TrackSpan tracks, std::vector<ThreatScore>& scores);
+    void (*prioritizeArena)(TrackSpan tracks, common::ArenaVector<ThreatScore>& scores);
+    void (*topK)(TrackSpan tracks, size_t k, std::vector<ThreatScore>& scores);
+    void (*topKArena)(TrackSpan tracks, size_t k, common::ArenaVector<ThreatScore>& scores);
+};
+
+// Registered policies, the default first; nullptr past threatPolicyCount()
+size_t threatPolicyCount();
+const ThreatPolicy* threatPolicy(size_t index);
+// nullptr if no policy has that name
+const ThreatPolicy* findThreatPolicy(const char* name);
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace skyguardis {
+namespace c2 {
+
+// Work done by the last ThreatRanking::sync()
+struct RankingStats {
+    size_t inserted;     // New tracks
+    size_t rescored;     // Tracks whose state changed
+    size_t unchanged;    // Tracks only compared
+    size_t removed;      // Tracks missing from the picture
+
+    RankingStats() : inserted(0), rescored(0), unchanged(0), removed(0) {}
+};
+
+// Threat order maintained across cycles in an indexed binary heap, so the
+// cost of keeping it current follows the churn of the picture instead of
+// its size: update() and remove() are O(log n), top() is O(1) and topK()
+// is O(k log k) whatever the number of tracks.
+//
+// Callers that know which tracks changed (e.g. a stream of track reports)
+// use update()/remove() directly. sync() takes a full picture instead; it
+// still visits every track, but an unchanged one only costs a lookup and a
+// comparison - no scoring and no heap work.
+//
+// Ordering is ThreatEvaluator::ranksHigher, so topK(k) matches the first k
+// entries of ThreatEvaluator::prioritize() on the same tracks.
+class ThreatRanking {
+public:
+    using ThreatScore = ThreatEvaluator::ThreatScore;
+
+    explicit ThreatRanking(const ThreatEvaluator& evaluator = ThreatEvaluator());
+
+    // Insert a new track or rescore a known one
+    void update(const Track& track);
+    // Returns false when the track is not ranked
+    bool remove(uint32_t track_id);
+    // Make the ranking match `tracks`: insert, rescore changed tracks and
+    // remove the ones that are gone. Scores then carry each track's index in
+    // `tracks` (update() resets it to NO_TRACK_INDEX).
+    void sync(TrackSpan tracks);
+    void clear();
+
+    size_t size() const { return heap_.size(); }
+    bool empty() const { return heap_.empty(); }
+    bool contains(uint32_t track_id) const { return index_.count(track_id) != 0; }
+
+    // Highest threat; false when empty
+    bool top(ThreatScore& best) const;
+    // The `k` highest threats, best first
+    void topK(size_t k, std::vector<ThreatScore>& scores) const;
+    bool find(uint32_t track_id, ThreatScore& score) const;
+
+    const RankingStats& getStats() const { return stats_; }
+
+private:
+    struct Entry {
+        Track track;            // State the score was computed from
+        ThreatScore score;
+        uint32_t heap_position;
+        uint32_t seen_sync;     // Last sync() that reported the track
+    };
+
+    ThreatEvaluator evaluator_;
+    std::vector<Entry> entries_;                      // Dense, unordered
+    std::vector<uint32_t> heap_;                      // Entry indices, best at the root
+    std::unordered_map<uint32_t, uint32_t> index_;    // Track id -> entry
+    uint32_t sync_count_;
+    RankingStats stats_;
+    mutable std::vector<uint32_t> frontier_;          // topK() scratch, heap positions
+
+    bool ranksAbove(uint32_t heap_a, uint32_t heap_b) const;
+    void place(uint32_t heap_position, uint32_t entry);
+    void siftUp(uint32_t heap_position);
+    void siftDown(uint32_t heap_position);
+    void restore(uint32_t heap_position);
+    void insert(const Track& track);
+    void rescore(uint32_t entry, const Track& track);
+    void erase(uint32_t entry);
+};
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "c2_controller/plot_associator.hpp"
+#include "c2_controller/threat_evaluator.hpp"
+#include "c2_controller/tracker_bank.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skyguardis {
+namespace c2 {
+
+// Position of a sensor in the fusion frame (ENU with the axes of every
+// sensor's local frame, metres)
+struct SensorSite {
+    double east_m;
+    double north_m;
+    double up_m;
+};
+
+// Fused track ids keep the local id of the first sensor holding the track
+// in the low bits and that sensor's index above FUSED_SENSOR_SHIFT, so
+// sensor 0 reports its own ids unchanged
+static constexpr uint32_t FUSED_SENSOR_SHIFT = 24;
+
+// Work done by the last fuse() call
+struct FusionStats {
+    size_t sensors;
+    size_t local_tracks;          // Confirmed tracks over all sensors
+    size_t merged;                // Local tracks merged into another sensor's track
+    size_t fused_tracks;
+
+    FusionStats() : sensors(0), local_tracks(0), merged(0), fused_tracks(0) {}
+};
+
+// Track-level fusion of several radars. Each sensor keeps its own
+// TrackerBank, fed with that sensor's reports in measurement order. At
+// fusion time every local picture is extrapolated to the common time,
+// shifted from the sensor's site into the fusion frame and merged sensor
+// by sensor: PlotAssociator pairs the local tracks with the fused picture
+// (Mahalanobis gate on the summed covariances), paired positions are
+// combined by their covariances and velocities by their variances, and
+// unpaired tracks join the picture. The local estimates are treated as
+// independent, which ignores their shared process noise.
+class TrackFusion {
+public:
+    TrackFusion();
+    explicit TrackFusion(const AssociatorConfig& association);
+
+    // Returns the sensor index used by processReport
+    uint32_t addSensor(const SensorSite& site, const TrackerConfig& config = TrackerConfig());
+    size_t sensorCount() const { return sensors_.size(); }
+    void clear();
+
+    // Plots measured by `sensor` at time_s; a sensor's reports must come
+    // in measurement order (different sensors may interleave)
+    void processReport(uint32_t sensor, const std::vector<Measurement>& plots, double time_s);
+
+    // Builds the fused picture at time_s
+    void fuse(double time_s);
+
+    TrackSpan getTracks() const { return TrackSpan(tracks_); }
+    const FusionStats& getStats() const { return stats_; }
+    const TrackerBank& getSensorBank(uint32_t sensor) const { return sensors_[sensor].bank; }
+
+private:
+    struct Sensor {
+        SensorSite site;
+        TrackerBank bank;
+    };
+
+    std::vector<Sensor> sensors_;
+    PlotAssociator associator_;
+    FusionStats stats_;
+
+    TrackEstimates fused_;
+    TrackEstimates local_;
+    std::vector<uint32_t> local_for_fused_;
+    std::vector<uint8_t> local_used_;
+    std::vector<Track> tracks_;
+
+    void merge(size_t fused, size_t local);
+    void append(size_t local, uint32_t sensor);
+};
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "c2_controller/plot_associator.hpp"
+#include "c2_controller/threat_evaluator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace skyguardis {
+namespace c2 {
+
+// Motion model assumed by every filter in a TrackerBank
+enum class TrackerModel {
+    CONSTANT_VELOCITY,  // Straight flight driven by white acceleration noise
+    CONSTANT_TURN       // Coordinated turn at each track's estimated turn rate
+};
+
+// How plots reach their filters
+enum class PlotRouting {
+    TRACK_ID,     // Plots carry the id of the track they measure; false alarms are dropped
+    ASSOCIATION   // Raw plots, associated to filters by PlotAssociator
+};
+
+struct TrackerConfig {
+    TrackerModel model;
+    PlotRouting routing;
+
+    // Measurement noise (1 sigma); should match the sensor
+    double range_sigma_m;
+    double azimuth_sigma_rad;
+    double elevation_sigma_rad;
+
+    // Process noise: white acceleration spectral density (m^2/s^3)
+    double acceleration_noise;
+
+    // Velocity uncertainty of a filter started from a single plot (1 sigma)
+    double initial_velocity_sigma_ms;
+
+    // CONSTANT_TURN: time constant of the turn rate estimate (observed from
+    // the rotation of the updated velocity) and the largest rate assumed
+    double turn_rate_time_s;
+    double max_turn_rate_rads;
+
+    // A filter is dropped after this many consecutive scans without a plot
+    uint32_t max_coast_scans;
+
+    // ASSOCIATION: gating and assignment, and the number of plots a filter
+    // started from an unassociated plot needs before it is reported.
+    // Tentative filters are dropped on their first miss.
+    AssociatorConfig association;
+    uint32_t confirm_plots;
+
+    TrackerConfig() : model(TrackerModel::CONSTANT_VELOCITY),
+                      routing(PlotRouting::TRACK_ID),
+                      range_sigma_m(25.0),
+                      azimuth_sigma_rad(0.0035),
+                      elevation_sigma_rad(0.0035),
+                      acceleration_noise(10.0),
+                      initial_velocity_sigma_ms(300.0),
+                      turn_rate_time_s(3.0),
+                      max_turn_rate_rads(0.5),
+                      max_coast_scans(5),
+                      confirm_plots(3) {}
+};
+
+// State covariance in ENU order: east, north, up, vel_east, vel_north, vel_up
+struct TrackCovariance {
+    double matrix[6][6];
+};
+
+// Confirmed filters extrapolated to a common time (see TrackerBank::extrapolate)
+struct TrackEstimates {
+    std::vector<uint32_t> id;
+    PositionSet position;                  // ENU position and its covariance
+    std::vector<double> vel_east_ms;
+    std::vector<double> vel_north_ms;
+    std::vector<double> vel_up_ms;
+    std::vector<double> velocity_variance; // Mean variance of the three velocity axes
+
+    size_t size() const { return id.size(); }
+    void resize(size_t count);
+};
+
+// Bank of Kalman filters, one per reporting track, stored column-wise.
+// Each scan predicts every filter to the scan time, then updates the ones
+// that received a plot. The state is Cartesian ENU (see common::EnuState);
+// a spherical plot is converted to a position measurement whose
+// covariance is the sensor noise mapped through the conversion Jacobian.
+// Predict and update are batch kernels over the columns and use the
+// instruction set selected for the batch kernels (common::getKernelIsa()).
+class TrackerBank {
+public:
+    TrackerBank();
+    explicit TrackerBank(const TrackerConfig& config);
+
+    void setConfig(const TrackerConfig& config);
+    const TrackerConfig& getConfig() const { return config_; }
+
+    // Run one scan at time_s (non-decreasing). With TRACK_ID routing a plot
+    // with an unknown id starts a new filter under that id; with
+    // ASSOCIATION routing an unassociated plot starts a tentative filter
+    // under an id allocated by the bank.
+    void processScan(const std::vector<Measurement>& plots, double time_s);
+    void clear();
+
+    // Smoothed picture after the last scan, one track per confirmed filter
+    TrackSpan getTracks() const { return TrackSpan(tracks_); }
+    size_t size() const { return id_.size(); }  // Including tentative filters
+    bool findTrack(uint32_t track_id, Track& track) const;
+    bool getCovariance(uint32_t track_id, TrackCovariance& covariance) const;
+
+    // Confirmed filters predicted in a straight line from the last scan to
+    // time_s, with the covariance grown to match; the bank is unchanged.
+    // Used to time-align the pictures of sensors that report at different
+    // times (see TrackFusion).
+    void extrapolate(double time_s, TrackEstimates& estimates) const;
+    double getTime() const { return time_s_; }  // Of the last scan
+
+    // Gating and assignment work of the last ASSOCIATION scan
+    const AssociationStats& getAssociationStats() const { return associator_.getStats(); }
+
+private:
+    static constexpr size_t STATE_TERMS = 6;       // Position and velocity
+    static constexpr size_t COVARIANCE_TERMS = 21; // Upper triangle of 6x6
+    static constexpr size_t TRANSITION_TERMS = 4;  // Turn coefficients per scan
+    static constexpr size_t PLOT_TERMS = 10;       // Position, covariance, weight
+
+    TrackerConfig config_;
+    PlotAssociator associator_;
+    double time_s_;
+    bool started_;
+    uint32_t next_track_id_;       // Next id for an ASSOCIATION filter
+
+    // Filter columns, one row per filter
+    std::vector<uint32_t> id_;
+    std::vector<double> state_[STATE_TERMS];
+    std::vector<double> covariance_[COVARIANCE_TERMS];
+    std::vector<double> transition_[TRANSITION_TERMS];
+    std::vector<double> plot_[PLOT_TERMS];
+    std::vector<double> turn_rate_rads_;
+    std::vector<double> last_vel_east_ms_;     // Velocity after the last update
+    std::vector<double> last_vel_north_ms_;
+    std::vector<double> last_plot_time_s_;
+    std::vector<uint32_t> plot_count_;
+    std::vector<uint32_t> missed_scans_;
+    std::unordered_map<uint32_t, uint32_t> id_row_;
+
+    std::vector<Track> tracks_;
+
+    // ASSOCIATION scratch (kept to reuse capacity between scans)
+    PositionSet predicted_;
+    PositionSet scan_plots_;
+    std::vector<uint32_t> plot_for_track_;
+    std::vector<uint8_t> plot_used_;
+
+    void routeById(const std::vector<Measurement>& plots, double time_s);
+    void routeByAssociation(const std::vector<Measurement>& plots, double time_s);
+    void setPlot(size_t row, const double (&position)[3], const double (&position_covariance)[3][3]);
+    void addFilter(uint32_t track_id, const double (&position)[3],
+                   const double (&position_covariance)[3][3], double time_s);
+    void removeFilter(size_t row);
+    bool isConfirmed(size_t row) const;
+    Track rowTrack(size_t row) const;
+    void prepareTransition(double delta_time_s);
+    void estimateTurnRates(double time_s);
+};
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace skyguardis {
+namespace common {
+
+// Stages of one C2 control cycle that heap allocations are charged to
+enum class CyclePhase : uint8_t {
+    IDLE = 0,            // Outside the instrumented stages (setup, shutdown)
+    RADAR_UPDATE,        // Track source: simulator update, tracker, replay or stream
+    THREAT_EVALUATION,   // Scoring and ranking in C2Controller::processTracks
+    ASSIGNMENT,          // Picking and sending the target assignment
+    LOGGING,
+    VISUALIZATION
+};
+
+constexpr size_t CYCLE_PHASE_COUNT = 6;
+
+// Heap allocations per phase (cumulative, or the difference of two
+// snapshots)
+struct AllocationCounts {
+    uint64_t allocations[CYCLE_PHASE_COUNT];
+    uint64_t bytes[CYCLE_PHASE_COUNT];
+
+    AllocationCounts();
+
+    uint64_t of(CyclePhase phase) const { return allocations[static_cast<size_t>(phase)]; }
+    uint64_t total() const;
+    AllocationCounts operator-(const AllocationCounts& earlier) const;
+};
+
+// Allocation tracking for the control loop.
+//
+// Building alloc_tracker.cpp with SKYGUARDIS_TRACK_ALLOCATIONS defined
+// (CMake option of the same name, `make TRACK_ALLOCATIONS=1`) replaces the
+// global operator new/delete and, on glibc, malloc/calloc/realloc with
+// versions that charge every allocation, from any thread, to the current
+// phase. Without it the phase is still recorded (one relaxed store) but
+// nothing is counted and allocationTrackingEnabled() returns false.
+bool allocationTrackingEnabled();
+void setAllocationPhase(CyclePhase phase);
+CyclePhase allocationPhase();
+AllocationCounts allocationCounts();  // Since process start
+const char* phaseName(CyclePhase phase);
+
+// Charges the allocations of a scope to `phase`, then restores the
+// previous phase
+class AllocationPhase {
+public:
+    explicit AllocationPhase(CyclePhase phase) : previous_(allocationPhase()) {
+        setAllocationPhase(phase);
+    }
+    ~AllocationPhase() { setAllocationPhase(previous_); }
+
+    AllocationPhase(const AllocationPhase&) = delete;
+    AllocationPhase& operator=(const AllocationPhase&) = delete;
+
+private:
+    CyclePhase previous_;
+};
+
+} // namespace common
+} // namespace skyguardis
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace skyguardis {
+namespace common {
+
+// Work done by a CycleArena since construction
+struct ArenaStats {
+    uint64_t cycles;                      // reset() calls
+    uint64_t allocations;                 // allocate() calls
+    uint64_t system_allocations;          // Blocks requested from operator new
+    uint64_t last_cycle_system_allocations;  // Of those, during the last completed cycle
+    size_t peak_bytes;                    // Largest cycle so far
+
+    ArenaStats() : cycles(0), allocations(0), system_allocations(0),
+                   last_cycle_system_allocations(0), peak_bytes(0) {}
+};
+
+// Monotonic arena for data that lives for one control cycle (threat
+// scores, log lines, visualizer frames). allocate() bumps a pointer and
+// deallocation is a no-op; reset() at the end of the cycle frees
+// everything at once.
+//
+// A cycle that outgrows the main block spills into extra blocks. The next
+// reset() releases them and regrows the main block to that cycle's size,
+// so after a few warm-up cycles a steady load never reaches operator new:
+// ArenaStats::last_cycle_system_allocations stays at zero.
+//
+// Not thread-safe: only the thread running the cycle may allocate.
+class CycleArena {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    explicit CycleArena(size_t capacity = DEFAULT_CAPACITY)
+        : main_(nullptr), main_capacity_(0), offset_(0), spill_(nullptr),
+          spill_offset_(0), cycle_bytes_(0), cycle_system_allocations_(0) {
+        growMain(capacity);
+    }
+
+    ~CycleArena() {
+        releaseSpill();
+        ::operator delete(main_);
+    }
+
+    CycleArena(const CycleArena&) = delete;
+    CycleArena& operator=(const CycleArena&) = delete;
+
+    // `alignment` must be a power of two
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        stats_.allocations++;
+        void* memory = spill_ ? bumpSpill(bytes, alignment) : bump(main_, main_capacity_, offset_,
+                                                                    bytes, alignment);
+        if (!memory) {
+            memory = spill(bytes, alignment);
+        }
+        return memory;
+    }
+
+    // Ends the cycle: everything allocated since the last reset is freed
+    void reset() {
+        if (cycle_bytes_ > stats_.peak_bytes) {
+            stats_.peak_bytes = cycle_bytes_;
+        }
+        if (spill_) {
+            // Room for the whole cycle in one block next time
+            releaseSpill();
+            size_t capacity = main_capacity_;
+            while (capacity < cycle_bytes_) {
+                capacity *= 2;
+            }
+            ::operator delete(main_);
+            main_ = nullptr;
+            growMain(capacity);
+        }
+        offset_ = 0;
+        cycle_bytes_ = 0;
+        stats_.cycles++;
+        stats_.last_cycle_system_allocations = cycle_system_allocations_;
+        cycle_system_allocations_ = 0;
+    }
+
+    size_t capacity() const { return main_capacity_; }
+    size_t used() const { return cycle_bytes_; }  // Bytes handed out this cycle, with padding
+    const ArenaStats& getStats() const { return stats_; }
+
+private:
+    // Extra block of the current cycle; the data follows the header
+    struct Spill {
+        Spill* next;
+        size_t capacity;
+    };
+
+    char* main_;
+    size_t main_capacity_;
+    size_t offset_;
+    Spill* spill_;               // Newest extra block (null while the main block suffices)
+    size_t spill_offset_;
+    size_t cycle_bytes_;
+    uint64_t cycle_system_allocations_;
+    ArenaStats stats_;
+
+    void* bump(char* block, size_t capacity, size_t& offset, size_t bytes, size_t alignment) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block);
+        const uintptr_t aligned = (base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        const size_t begin = static_cast<size_t>(aligned - base);
+        if (begin > capacity || bytes > capacity - begin) {
+            return nullptr;
+        }
+        cycle_bytes_ += begin + bytes - offset;
+        offset = begin + bytes;
+        return block + begin;
+    }
+
+    void* bumpSpill(size_t bytes, size_t alignment) {
+        return bump(reinterpret_cast<char*>(spill_ + 1), spill_->capacity, spill_offset_, bytes,
+                    alignment);
+    }
+
+    void* spill(size_t bytes, size_t alignment) {
+        size_t capacity = main_capacity_;
+        while (capacity < bytes + alignment) {
+            capacity *= 2;
+        }
+        Spill* block = static_cast<Spill*>(::operator new(sizeof(Spill) + capacity));
+        countSystemAllocation();
+        block->next = spill_;
+        block->capacity = capacity;
+        spill_ = block;
+        spill_offset_ = 0;
+        return bumpSpill(bytes, alignment);
+    }
+
+    void releaseSpill() {
+        while (spill_) {
+            Spill* next = spill_->next;
+            ::operator delete(spill_);
+            spill_ = next;
+        }
+    }
+
+    void growMain(size_t capacity) {
+        main_capacity_ = capacity > 0 ? capacity : DEFAULT_CAPACITY;
+        main_ = static_cast<char*>(::operator new(main_capacity_));
+        countSystemAllocation();
+    }
+
+    void countSystemAllocation() {
+        stats_.system_allocations++;
+        cycle_system_allocations_++;
+    }
+};
+
+// Standard allocator drawing from a CycleArena. A default-constructed
+// allocator (no arena) falls back to operator new, so containers using it
+// also work outside the cycle.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept : arena_(nullptr) {}
+    explicit ArenaAllocator(CycleArena* arena) noexcept : arena_(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    T* allocate(size_t count) {
+        if (!arena_) {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+        if (!arena_) {
+            ::operator delete(pointer);
+        }
+    }
+
+    CycleArena* arena() const noexcept { return arena_; }
+
+private:
+    CycleArena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena() != b.arena();
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Null-terminated text built with printf-style appends in a CycleArena
+// (on the heap when the arena is null). Replaces std::stringstream on the
+// per-cycle logging and display paths.
+class ArenaText {
+public:
+    explicit ArenaText(CycleArena* arena, size_t capacity = 256)
+        : chars_(ArenaAllocator<char>(arena)) {
+        chars_.reserve(capacity);
+        chars_.push_back('\0');
+    }
+
+    void append(const char* text, size_t length) {
+        chars_.insert(chars_.end() - 1, text, text + length);
+    }
+
+    void append(const char* text) {
+        append(text, std::strlen(text));
+    }
+
+    void append(char c, size_t count = 1) {
+        chars_.insert(chars_.end() - 1, count, c);
+    }
+
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    void appendf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        vappendf(format, args);
+        va_end(args);
+    }
+
+    void vappendf(const char* format, va_list args) {
+        va_list retry;
+        va_copy(retry, args);
+
+        // Format into the spare capacity; grow once if it does not fit
+        const size_t length = size();
+        chars_.resize(chars_.capacity());
+        const size_t room = chars_.size() - length;
+        const int needed = std::vsnprintf(chars_.data() + length, room, format, args);
+        if (needed < 0) {
+            chars_.resize(length + 1);
+            chars_[length] = '\0';
+        } else {
+            if (static_cast<size_t>(needed) >= room) {
+                chars_.resize(length + needed + 1);
+                std::vsnprintf(chars_.data() + length, needed + 1, format, retry);
+            }
+            chars_.resize(length + needed + 1);
+        }
+        va_end(retry);
+    }
+
+    void clear() {
+        chars_.resize(1);
+        chars_[0] = '\0';
+    }
+
+    const char* c_str() const { return chars_.data(); }
+    size_t size() const { return chars_.size() - 1; }
+    bool empty() const { return chars_.size() == 1; }
+
+private:
+    ArenaVector<char> chars_;
+};
+
+} // namespace common
+} // namespace skyguardis
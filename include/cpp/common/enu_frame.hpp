@@ -0,0 +1,29 @@
+#pragma once
+
+namespace skyguardis {
+namespace c2 {
+struct Track;
+} // namespace c2
+
+namespace common {
+
+// Kinematic state in the radar-centred East-North-Up frame.
+// Azimuth and heading are measured clockwise from north, elevation up
+// from the horizontal plane (see toEnu / toSpherical).
+struct EnuState {
+    double east_m;
+    double north_m;
+    double up_m;
+    double vel_east_ms;
+    double vel_north_ms;
+    double vel_up_ms;
+};
+
+// Conversions between the spherical track report and the Cartesian state.
+// toEnu assumes level flight (no vertical velocity) along the heading;
+// toSpherical fills every field except the id.
+EnuState toEnu(const c2::Track& track);
+void toSpherical(const EnuState& state, c2::Track& track);
+
+} // namespace common
+} // namespace skyguardis
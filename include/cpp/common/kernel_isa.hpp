@@ -0,0 +1,34 @@
+#pragma once
+
+// Instruction set selection for the batch (SIMD) kernels of the radar
+// simulator and the C2 node. Each kernel family is compiled for every set
+// under SKYGUARDIS_X86_KERNELS and picks one at run time with
+// getKernelIsa(), so a single binary runs on any x86-64 CPU.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SKYGUARDIS_X86_KERNELS 1
+#endif
+
+namespace skyguardis {
+namespace common {
+
+// Instruction set used by the batch kernels
+enum class KernelIsa {
+    SCALAR,   // Portable per-element loop (reference implementation)
+    SSE41,    // 2 doubles per instruction
+    AVX2      // 4 doubles per instruction (with FMA)
+};
+
+// Best instruction set supported by the running CPU
+KernelIsa detectKernelIsa();
+
+// Instruction set currently used by the batch kernels (detected on first use)
+KernelIsa getKernelIsa();
+
+// Force a specific instruction set (for tests and benchmarks).
+// Falls back to the best supported set if the CPU lacks the requested one.
+void setKernelIsa(KernelIsa isa);
+
+const char* kernelIsaName(KernelIsa isa);
+
+} // namespace common
+} // namespace skyguardis
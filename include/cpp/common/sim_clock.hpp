@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace skyguardis {
+namespace common {
+
+// Time source shared by the radar simulator, the C2 loop and the logger.
+// Components hold a non-owning Clock* and default to systemClock(), so
+// production code keeps reading the real clocks while tests and soak runs
+// can swap in a VirtualClock.
+class Clock {
+public:
+    virtual ~Clock() = default;
+    
+    // Monotonic time in seconds (arbitrary epoch)
+    virtual double now() const = 0;
+    
+    // Calendar time, for log timestamps
+    virtual std::chrono::system_clock::time_point wallTime() const = 0;
+    
+    // Block until `seconds` of this clock's time have passed
+    virtual void sleepFor(double seconds) = 0;
+};
+
+// Real time: steady_clock for now(), system_clock for wallTime()
+class SteadyClock : public Clock {
+public:
+    double now() const override;
+    std::chrono::system_clock::time_point wallTime() const override;
+    void sleepFor(double seconds) override;
+};
+
+// Simulated time that only moves when advanced. sleepFor() returns
+// immediately after advancing, so a loop paced by sleepFor() runs as fast
+// as the CPU allows. Safe to read from several threads.
+class VirtualClock : public Clock {
+public:
+    // Starts at `start_s`; wallTime() is anchored to the real calendar time
+    // at construction
+    explicit VirtualClock(double start_s = 0.0);
+    
+    double now() const override;
+    std::chrono::system_clock::time_point wallTime() const override;
+    void sleepFor(double seconds) override;
+    
+    void advance(double seconds);
+    void setTime(double seconds);
+
+private:
+    std::atomic<int64_t> now_ns_;
+    int64_t start_ns_;
+    std::chrono::system_clock::time_point wall_anchor_;
+};
+
+// Process-wide real-time clock used when nothing else is injected
+Clock& systemClock();
+
+} // namespace common
+} // namespace skyguardis
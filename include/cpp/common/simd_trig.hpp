@@ -0,0 +1,122 @@
+#pragma once
+
+#include "common/kernel_isa.hpp"
+
+#ifdef SKYGUARDIS_X86_KERNELS
+#include <immintrin.h>
+
+namespace skyguardis {
+namespace common {
+
+// Vector sin/cos for the batch kernels (radar motion, threat geometry).
+// sincos4 and sincos2 compute 4 and 2 lanes under the AVX2/FMA and SSE4.1
+// targets; callers compile their kernels for the same target.
+namespace trig {
+
+// sin/cos kernel: Cody-Waite reduction by pi/2 followed by the fdlibm
+// minimax polynomials on [-pi/4, pi/4] and a branch-free quadrant fix-up.
+constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;
+constexpr double PIO2_1 = 1.57079632673412561417e+00;
+constexpr double PIO2_2 = 6.07710050630396597660e-11;
+constexpr double PIO2_2T = 2.02226624879595063154e-21;
+
+constexpr double S1 = -1.66666666666666324348e-01;
+constexpr double S2 = 8.33333333332248946124e-03;
+constexpr double S3 = -1.98412698298579493134e-04;
+constexpr double S4 = 2.75573137070700676789e-06;
+constexpr double S5 = -2.50507602534068634195e-08;
+constexpr double S6 = 1.58969099521155010221e-10;
+
+constexpr double C1 = 4.16666666666666019037e-02;
+constexpr double C2 = -1.38888888888741095749e-03;
+constexpr double C3 = 2.48015872894767294178e-05;
+constexpr double C4 = -2.75573143513906633035e-07;
+constexpr double C5 = 2.08757232129817482790e-09;
+constexpr double C6 = -1.13596475577881948265e-11;
+
+} // namespace trig
+
+__attribute__((target("avx2,fma")))
+inline void sincos4(__m256d x, __m256d& sin_out, __m256d& cos_out) {
+    const __m256d q = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(trig::TWO_OVER_PI)),
+                                      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(q, _mm256_set1_pd(trig::PIO2_1), x);
+    r = _mm256_fnmadd_pd(q, _mm256_set1_pd(trig::PIO2_2), r);
+    r = _mm256_fnmadd_pd(q, _mm256_set1_pd(trig::PIO2_2T), r);
+    const __m256d z = _mm256_mul_pd(r, r);
+
+    __m256d ps = _mm256_fmadd_pd(z, _mm256_set1_pd(trig::S6), _mm256_set1_pd(trig::S5));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(trig::S4));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(trig::S3));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(trig::S2));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(trig::S1));
+    const __m256d s = _mm256_fmadd_pd(_mm256_mul_pd(r, z), ps, r);
+
+    __m256d pc = _mm256_fmadd_pd(z, _mm256_set1_pd(trig::C6), _mm256_set1_pd(trig::C5));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(trig::C4));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(trig::C3));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(trig::C2));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(trig::C1));
+    const __m256d c = _mm256_fmadd_pd(_mm256_mul_pd(z, z), pc,
+                                      _mm256_fnmadd_pd(_mm256_set1_pd(0.5), z, _mm256_set1_pd(1.0)));
+
+    // Quadrant q mod 4 selects (sin, cos) = (s, c), (c, -s), (-s, -c), (-c, s)
+    const __m256d qm = _mm256_fnmadd_pd(_mm256_set1_pd(4.0),
+                                        _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25))), q);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d is1 = _mm256_cmp_pd(qm, one, _CMP_EQ_OQ);
+    const __m256d is2 = _mm256_cmp_pd(qm, two, _CMP_EQ_OQ);
+    const __m256d is3 = _mm256_cmp_pd(qm, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+    const __m256d swap = _mm256_or_pd(is1, is3);
+    const __m256d sin_neg = _mm256_cmp_pd(qm, two, _CMP_GE_OQ);
+    const __m256d cos_neg = _mm256_or_pd(is1, is2);
+
+    sin_out = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), _mm256_and_pd(sin_neg, sign));
+    cos_out = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), _mm256_and_pd(cos_neg, sign));
+}
+
+__attribute__((target("sse4.1")))
+inline void sincos2(__m128d x, __m128d& sin_out, __m128d& cos_out) {
+    const __m128d q = _mm_round_pd(_mm_mul_pd(x, _mm_set1_pd(trig::TWO_OVER_PI)),
+                                   _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m128d r = _mm_sub_pd(x, _mm_mul_pd(q, _mm_set1_pd(trig::PIO2_1)));
+    r = _mm_sub_pd(r, _mm_mul_pd(q, _mm_set1_pd(trig::PIO2_2)));
+    r = _mm_sub_pd(r, _mm_mul_pd(q, _mm_set1_pd(trig::PIO2_2T)));
+    const __m128d z = _mm_mul_pd(r, r);
+
+    __m128d ps = _mm_add_pd(_mm_mul_pd(z, _mm_set1_pd(trig::S6)), _mm_set1_pd(trig::S5));
+    ps = _mm_add_pd(_mm_mul_pd(z, ps), _mm_set1_pd(trig::S4));
+    ps = _mm_add_pd(_mm_mul_pd(z, ps), _mm_set1_pd(trig::S3));
+    ps = _mm_add_pd(_mm_mul_pd(z, ps), _mm_set1_pd(trig::S2));
+    ps = _mm_add_pd(_mm_mul_pd(z, ps), _mm_set1_pd(trig::S1));
+    const __m128d s = _mm_add_pd(r, _mm_mul_pd(_mm_mul_pd(r, z), ps));
+
+    __m128d pc = _mm_add_pd(_mm_mul_pd(z, _mm_set1_pd(trig::C6)), _mm_set1_pd(trig::C5));
+    pc = _mm_add_pd(_mm_mul_pd(z, pc), _mm_set1_pd(trig::C4));
+    pc = _mm_add_pd(_mm_mul_pd(z, pc), _mm_set1_pd(trig::C3));
+    pc = _mm_add_pd(_mm_mul_pd(z, pc), _mm_set1_pd(trig::C2));
+    pc = _mm_add_pd(_mm_mul_pd(z, pc), _mm_set1_pd(trig::C1));
+    const __m128d c = _mm_add_pd(_mm_sub_pd(_mm_set1_pd(1.0), _mm_mul_pd(_mm_set1_pd(0.5), z)),
+                                 _mm_mul_pd(_mm_mul_pd(z, z), pc));
+
+    const __m128d qm = _mm_sub_pd(q, _mm_mul_pd(_mm_set1_pd(4.0),
+                                                _mm_floor_pd(_mm_mul_pd(q, _mm_set1_pd(0.25)))));
+    const __m128d two = _mm_set1_pd(2.0);
+    const __m128d sign = _mm_set1_pd(-0.0);
+    const __m128d is1 = _mm_cmpeq_pd(qm, _mm_set1_pd(1.0));
+    const __m128d is2 = _mm_cmpeq_pd(qm, two);
+    const __m128d is3 = _mm_cmpeq_pd(qm, _mm_set1_pd(3.0));
+    const __m128d swap = _mm_or_pd(is1, is3);
+    const __m128d sin_neg = _mm_cmpge_pd(qm, two);
+    const __m128d cos_neg = _mm_or_pd(is1, is2);
+
+    sin_out = _mm_xor_pd(_mm_blendv_pd(s, c, swap), _mm_and_pd(sin_neg, sign));
+    cos_out = _mm_xor_pd(_mm_blendv_pd(c, s, swap), _mm_and_pd(cos_neg, sign));
+}
+
+} // namespace common
+} // namespace skyguardis
+
+#endif // SKYGUARDIS_X86_KERNELS
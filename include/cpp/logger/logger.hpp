@@ -1,11 +1,14 @@
 #pragma once
 
+#include "common/cycle_arena.hpp"
+#include "common/sim_clock.hpp"
 #include "message_gateway/protocol.hpp"
 #include <string>
 #include <fstream>
 #include <memory>
 #include <mutex>
 #include <chrono>
+#include <ctime>
 
 namespace skyguardis {
 namespace logger {
@@ -32,6 +35,13 @@ public:
     // Legacy method (maps to INFO)
     void log(const std::string& message);
     
+    // printf-style message, formatted only when the level is enabled
+#if defined(__GNUC__)
+    __attribute__((format(printf, 3, 4)))
+#endif
+    void logf(LogLevel level, const char* format, ...);
+    bool isEnabled(LogLevel level) const { return level >= current_level_; }
+    
     // Specialized logging
     void logEngagement(const protocol::EngagementStatus& status);
     void logTargetAssignment(uint32_t target_id, double range_m, double azimuth_rad);
@@ -43,6 +53,11 @@ public:
     void setLogLevel(LogLevel level);
     void setLogFile(const std::string& filename);
     void enableConsoleOutput(bool enable);
+    void setClock(common::Clock* clock); // Timestamp source (defaults to common::systemClock())
+    
+    // Log lines are formatted in this arena (null: heap). Only set it when
+    // every message comes from the thread that resets the arena.
+    void setCycleArena(common::CycleArena* arena);
     
     // Performance metrics
     void logPerformanceMetric(const std::string& metric_name, double value, const std::string& unit = "");
@@ -52,10 +67,18 @@ private:
     std::unique_ptr<std::ofstream> log_file_;
     std::mutex log_mutex_;
     bool console_output_;
+    common::Clock* clock_;
+    common::CycleArena* arena_;
+    
+    // Calendar part of the timestamp, formatted once per second
+    // (localtime() can allocate on every call)
+    std::time_t calendar_second_;
+    char calendar_[32];
     
-    std::string getTimestamp() const;
-    std::string levelToString(LogLevel level) const;
+    void appendTimestamp(common::ArenaText& out);
+    const char* levelToString(LogLevel level) const;
     void writeLog(LogLevel level, const std::string& message);
+    void writeLog(LogLevel level, const char* message, size_t length);
 };
 
 } // namespace logger
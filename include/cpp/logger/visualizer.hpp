@@ -1,6 +1,7 @@
 #pragma once
 
 #include "c2_controller/threat_evaluator.hpp"
+#include "common/cycle_arena.hpp"
 #include "message_gateway/protocol.hpp"
 #include <vector>
 #include <string>
@@ -23,9 +24,9 @@ public:
     ~Visualizer();
     
     // Track visualization
-    void visualizeTracks(const std::vector<c2::Track>& tracks);
-    void visualizeTracksTable(const std::vector<c2::Track>& tracks);
-    void visualizeTracksCompact(const std::vector<c2::Track>& tracks);
+    void visualizeTracks(c2::TrackSpan tracks);
+    void visualizeTracksTable(c2::TrackSpan tracks);
+    void visualizeTracksCompact(c2::TrackSpan tracks);
     
     // Engagement status visualization
     void visualizeEngagementStatus(const protocol::EngagementStatus& status);
@@ -37,7 +38,7 @@ public:
     
     // Combined dashboard
     void visualizeDashboard(
-        const std::vector<c2::Track>& tracks,
+        c2::TrackSpan tracks,
         const protocol::EngagementStatus& status,
         bool safety_status
     );
@@ -48,8 +49,11 @@ public:
     void enableAutoClear(bool enable);  // Clear screen before update
     void setOutputFile(const std::string& filename);
     
+    // Frames are built in this arena (null: heap) before being written out
+    void setCycleArena(common::CycleArena* arena) { arena_ = arena; }
+    
     // Legacy method (for compatibility)
-    void visualize(const std::vector<c2::Track>& tracks);
+    void visualize(c2::TrackSpan tracks);
 
 private:
     VisualFormat format_;
@@ -57,17 +61,21 @@ private:
     int cycle_count_;
     bool auto_clear_;
     std::unique_ptr<std::ofstream> output_file_;
+    common::CycleArena* arena_;
     
-    // Helper methods
-    void clearScreen();
-    void printHeader();
-    void printSeparator();
-    std::string formatAngle(double radians) const;
-    std::string formatRange(double meters) const;
-    std::string formatVelocity(double ms) const;
-    std::string getStateString(uint8_t state) const;
-    std::string getSafetyStatusString(bool is_safe) const;
-    void writeToFile(const std::string& content);
+    // Helper methods: each display call builds its frame in the arena and
+    // writes it to the console in one piece
+    static constexpr size_t FIELD_CHARS = 32;  // Buffer size for the format helpers
+    void clearScreen(common::ArenaText& frame);
+    void printHeader(common::ArenaText& frame);
+    void printSeparator(common::ArenaText& frame);
+    void printFrame(const common::ArenaText& frame);
+    const char* formatAngle(double radians, char* out) const;
+    const char* formatRange(double meters, char* out) const;
+    const char* formatVelocity(double ms, char* out) const;
+    const char* getStateString(uint8_t state) const;
+    const char* getSafetyStatusString(bool is_safe) const;
+    void writeToFile(const common::ArenaText& content);
 };
 
 } // namespace logger
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "c2_controller/threat_evaluator.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -11,7 +13,8 @@ enum class MessageType : uint8_t {
     TARGET_ASSIGNMENT = 1,
     ENGAGEMENT_STATUS = 2,
     SAFETY_INTERLOCK = 3,
-    HEARTBEAT = 4
+    HEARTBEAT = 4,
+    TRACK_REPORT = 5
 };
 
 // Target assignment message (C++ -> Ada)
@@ -37,6 +40,24 @@ struct EngagementStatus {
     static constexpr size_t SERIALIZED_SIZE = 28; // 6 header + 22 payload
 };
 
+// Batched track report (radar_sim -> C2 node).
+// One radar cycle is split into batch_count datagrams of at most
+// MAX_TRACKS tracks each; every batch but the last is full, so a track's
+// position in the cycle is batch_index * MAX_TRACKS + its index in the batch.
+struct TrackReport {
+    uint32_t cycle;           // Radar cycle the tracks belong to
+    uint16_t batch_index;     // 0 .. batch_count - 1
+    uint16_t batch_count;
+    uint16_t track_count;     // Tracks in this datagram
+    
+    static constexpr size_t HEADER_SIZE = 16;      // 6 header + 10 report fields
+    static constexpr size_t TRACK_SIZE = 44;       // id + 5 doubles
+    static constexpr size_t MAX_TRACKS = 1000;     // Keeps datagrams under 64 KiB
+    static constexpr size_t MAX_SERIALIZED_SIZE = HEADER_SIZE + MAX_TRACKS * TRACK_SIZE;
+    
+    static size_t serializedSize(size_t track_count) { return HEADER_SIZE + track_count * TRACK_SIZE; }
+};
+
 // Serialization functions
 bool serializeTargetAssignment(const TargetAssignment& msg, uint8_t* buffer, size_t buffer_size);
 bool deserializeTargetAssignment(const uint8_t* buffer, size_t buffer_size, TargetAssignment& msg);
@@ -44,6 +65,14 @@ bool deserializeTargetAssignment(const uint8_t* buffer, size_t buffer_size, Targ
 bool serializeEngagementStatus(const EngagementStatus& msg, uint8_t* buffer, size_t buffer_size);
 bool deserializeEngagementStatus(const uint8_t* buffer, size_t buffer_size, EngagementStatus& msg);
 
+// Track reports: `tracks` holds report.track_count entries
+bool serializeTrackReport(const TrackReport& report, const c2::Track* tracks,
+                          uint8_t* buffer, size_t buffer_size);
+// Reads the report fields and up to max_tracks tracks (fails if the
+// report carries more)
+bool deserializeTrackReport(const uint8_t* buffer, size_t buffer_size, TrackReport& report,
+                            c2::Track* tracks, size_t max_tracks);
+
 uint16_t calculateChecksum(const uint8_t* data, size_t length);
 bool validateChecksum(const uint8_t* data, size_t length, uint16_t checksum);
 
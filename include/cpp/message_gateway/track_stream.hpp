@@ -0,0 +1,95 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "message_gateway/protocol.hpp"
+#include <cstdint>
+#include <vector>
+
+// Forward declarations
+struct sockaddr_in;
+
+namespace skyguardis {
+namespace gateway {
+
+static constexpr uint16_t DEFAULT_TRACK_STREAM_PORT = 8890;
+
+// Streams radar cycles to the C2 node as batched TRACK_REPORT datagrams
+class TrackStreamSender {
+public:
+    TrackStreamSender();
+    ~TrackStreamSender();
+    
+    bool initialize(uint16_t port = DEFAULT_TRACK_STREAM_PORT, const char* host = "127.0.0.1");
+    
+    // Send one cycle (split into as many reports as needed; an empty
+    // picture is sent as a single empty report)
+    bool sendTracks(uint32_t cycle, c2::TrackSpan tracks);
+    
+    void shutdown();
+    bool isInitialized() const { return initialized_; }
+    uint64_t getDatagramsSent() const { return datagrams_sent_; }
+
+private:
+    int socket_;
+    struct sockaddr_in* addr_;
+    bool initialized_;
+    uint64_t datagrams_sent_;
+    std::vector<uint8_t> buffer_;
+};
+
+// Receives TRACK_REPORT datagrams and reassembles complete cycles.
+// Cycles with a missing batch are dropped once a newer cycle starts.
+class TrackStreamReceiver {
+public:
+    struct Stats {
+        uint64_t cycles_completed;
+        uint64_t cycles_dropped;      // Superseded before all batches arrived
+        uint64_t reports_rejected;    // Malformed, inconsistent or stale
+    };
+    
+    TrackStreamReceiver();
+    ~TrackStreamReceiver();
+    
+    bool initialize(uint16_t port = DEFAULT_TRACK_STREAM_PORT);
+    
+    // Drain pending datagrams (non-blocking). Returns true if at least one
+    // new cycle was completed.
+    bool poll();
+    
+    // Latest complete cycle; valid until the next poll()
+    c2::TrackSpan getTracks() const { return c2::TrackSpan(complete_); }
+    uint32_t getCycle() const { return complete_cycle_; }
+    bool hasTracks() const { return has_complete_; }
+    
+    const Stats& getStats() const { return stats_; }
+    void shutdown();
+    bool isInitialized() const { return initialized_; }
+
+private:
+    int socket_;
+    bool initialized_;
+    Stats stats_;
+    
+    // Receive scratch
+    std::vector<uint8_t> datagram_;
+    std::vector<c2::Track> batch_tracks_;
+    
+    // Cycle being assembled
+    bool assembling_;
+    uint32_t assembling_cycle_;
+    uint16_t assembling_batch_count_;
+    uint16_t batches_remaining_;
+    size_t assembling_size_;
+    std::vector<uint8_t> batch_seen_;
+    std::vector<c2::Track> assembling_tracks_;
+    
+    // Last complete cycle
+    bool has_complete_;
+    uint32_t complete_cycle_;
+    std::vector<c2::Track> complete_;
+    
+    bool handleReport(const protocol::TrackReport& report);
+};
+
+} // namespace gateway
+} // namespace skyguardis
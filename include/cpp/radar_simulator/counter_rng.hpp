@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace skyguardis {
+namespace radar {
+
+// Counter-based random number generator (Philox4x32-10).
+// Every draw is a pure function of (seed, track id, cycle, stream, draw
+// index), so a run replays exactly from its seed and any thread can
+// generate any track's numbers without sharing generator state.
+class CounterRng {
+public:
+    // Independent sequences for the same (track, cycle)
+    enum class Stream : uint32_t {
+        TRACK_SPAWN = 1,     // Initial kinematics of a new track
+        MANEUVER = 2,        // Per-cycle maneuver changes
+        SPAWN_DECISION = 3,  // Scenario-level "add a track this cycle?" draws
+        MEASUREMENT = 4,     // Sensor noise and detection draw on a track's plot
+        CLUTTER_COUNT = 5,   // Number of false alarms in a scan
+        CLUTTER = 6          // False alarm positions (keyed by false alarm index)
+    };
+    
+    using Block = std::array<uint32_t, 4>;
+    
+    using Key = std::array<uint32_t, 2>;
+    
+    CounterRng(uint64_t seed, uint32_t track_id, uint64_t cycle, Stream stream)
+        : key_(makeKey(seed)), counter_(makeCounter(track_id, cycle, stream)), position_(4) {}
+    
+    // Key and first counter of the sequence for (seed, track id, cycle,
+    // stream). Block n of the sequence is philox() of that counter with
+    // word 0 set to n, which lets batch generators skip the object.
+    static Key makeKey(uint64_t seed) {
+        return {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    }
+    static Block makeCounter(uint32_t track_id, uint64_t cycle, Stream stream) {
+        return {0, track_id, static_cast<uint32_t>(cycle),
+                static_cast<uint32_t>(cycle >> 32) ^ (static_cast<uint32_t>(stream) << 24)};
+    }
+    
+    // Next 32 random bits
+    uint32_t next() {
+        if (position_ == 4) {
+            block_ = philox(counter_, key_);
+            ++counter_[0];
+            position_ = 0;
+        }
+        return block_[position_++];
+    }
+    
+    // Uniform double in [0, 1) with 53 random bits
+    double uniform() {
+        uint64_t high = next() >> 5;
+        uint64_t low = next() >> 6;
+        return (high * 67108864.0 + low) * (1.0 / 9007199254740992.0);
+    }
+    
+    // Uniform double in [low, high)
+    double uniform(double low, double high) {
+        return low + (high - low) * uniform();
+    }
+    
+    // Standard normal deviate (Box-Muller; uses two uniforms per draw)
+    double gaussian() {
+        const double radius = std::sqrt(-2.0 * std::log(1.0 - uniform()));
+        return radius * std::cos(6.283185307179586 * uniform());
+    }
+    
+    // Philox4x32 with 10 rounds
+    static Block philox(Block counter, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+            uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+            counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<uint32_t>(product1),
+                       static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<uint32_t>(product0)};
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        return counter;
+    }
+    
+    // Philox over `count` counters held in four lane columns, in place.
+    // Same rounds as philox(); the inner loops run across lanes so the
+    // 32x32->64 multiplies vectorise.
+    template <size_t N>
+    static void philoxLanes(uint32_t (&lanes)[4][N], size_t count, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            const uint32_t key0 = key[0];
+            const uint32_t key1 = key[1];
+            for (size_t i = 0; i < count; ++i) {
+                const uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * lanes[0][i];
+                const uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * lanes[2][i];
+                const uint32_t word0 = static_cast<uint32_t>(product1 >> 32) ^ lanes[1][i] ^ key0;
+                const uint32_t word2 = static_cast<uint32_t>(product0 >> 32) ^ lanes[3][i] ^ key1;
+                lanes[0][i] = word0;
+                lanes[1][i] = static_cast<uint32_t>(product1);
+                lanes[2][i] = word2;
+                lanes[3][i] = static_cast<uint32_t>(product0);
+            }
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+    }
+
+private:
+    Key key_;
+    Block counter_;
+    Block block_;
+    int position_;
+};
+
+} // namespace radar
+} // namespace skyguardis
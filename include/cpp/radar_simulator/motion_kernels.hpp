@@ -0,0 +1,39 @@
+#pragma once
+
+#include "common/kernel_isa.hpp"
+#include "radar_simulator/track_state.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace skyguardis {
+namespace radar {
+namespace motion {
+
+// The batch kernels run on the instruction set selected by
+// common::getKernelIsa(); positions convert to and from track reports
+// with common::toEnu / common::toSpherical.
+
+// Scalar reference kinematics for a single track.
+// advanceLinear moves the position along the velocity vector;
+// advanceManeuver changes speed by acceleration_ms2 * dt (clamped to the
+// simulator's speed limits) and turns the horizontal velocity clockwise
+// by angular_velocity_rads * dt.
+void advanceLinear(EnuState& state, double delta_time_s);
+void advanceManeuver(EnuState& state, double acceleration_ms2,
+                     double angular_velocity_rads, double delta_time_s);
+
+// Batch kinematics over columnar arrays of `count` tracks.
+// Only tracks whose mask byte is non-zero are advanced; pass nullptr to
+// advance every track. Results agree with the scalar functions above to
+// within floating point rounding.
+void advanceLinearBatch(double* east_m, double* north_m, double* up_m,
+                        const double* vel_east_ms, const double* vel_north_ms,
+                        const double* vel_up_ms,
+                        const uint8_t* mask, size_t count, double delta_time_s);
+void advanceManeuverBatch(double* vel_east_ms, double* vel_north_ms, double* vel_up_ms,
+                          const double* acceleration_ms2, const double* angular_velocity_rads,
+                          const uint8_t* mask, size_t count, double delta_time_s);
+
+} // namespace motion
+} // namespace radar
+} // namespace skyguardis
@@ -1,15 +1,33 @@
 #pragma once
 
 #include "c2_controller/threat_evaluator.hpp"
+#include "common/sim_clock.hpp"
 #include "radar_simulator/scenario_manager.hpp"
+#include "radar_simulator/sensor_model.hpp"
+#include "radar_simulator/track_recording.hpp"
 #include "radar_simulator/track_state.hpp"
+#include "radar_simulator/track_store.hpp"
 #include <vector>
 #include <memory>
-#include <chrono>
+#include <string>
+#include <mutex>
 
 namespace skyguardis {
 namespace radar {
 
+// Read-only view of the published track picture.
+// The tracks live in one half of RadarSimulator's double buffer, so a
+// snapshot stays valid until the second publish after it was taken (i.e.
+// for the rest of the cycle in which it was read). Compare generations to
+// tell whether a newer picture exists. The spherical tracks are converted
+// from the Cartesian store on the first read after a publish, so cycles
+// nobody looks at cost no conversion.
+struct TrackSnapshot {
+    c2::TrackSpan tracks;
+    uint64_t generation;          // Incremented on every publish
+    double time_s;                // Clock time of the publish
+};
+
 class RadarSimulator {
 public:
     RadarSimulator();
@@ -17,24 +35,77 @@ public:
     
     // Track generation and updates
     void generateTracks();
-    void updateTracks(double delta_time_s = 0.1); // Default 100ms cycle
-    std::vector<c2::Track> getCurrentTracks() const;
+    void updateTracks(double delta_time_s = 0.1); // Default 100ms cycle; <= 0 uses clock time since last update
+    std::vector<c2::Track> getCurrentTracks() const; // Copy of getSnapshot().tracks
+    TrackSnapshot getSnapshot() const;                // Active tracks, no copy
+    
+    // Plots of the last update as seen through the sensor model: noisy
+    // detections of the active tracks (Pd permitting), then false alarms.
+    // Every draw is keyed by (seed, id, cycle), so repeated calls in one
+    // cycle return the same plots. Fills `plots` in place.
+    void getMeasurements(std::vector<c2::Measurement>& plots);
+    // Same, through an external sensor (e.g. one of a SensorNetwork)
+    void getMeasurements(SensorModel& sensor, std::vector<c2::Measurement>& plots) const;
+    void setMeasurementNoise(const MeasurementNoise& noise);
+    void setSensorConfig(const SensorConfig& config);
+    SensorStats getSensorStats() const;   // Of the last getMeasurements()
     
     // Scenario management
     void setScenario(ScenarioType type, const ScenarioConfig& config = ScenarioConfig());
     ScenarioType getCurrentScenario() const;
     
+    // Scenario script for ScenarioType::SCRIPTED (see TrajectoryTable)
+    bool loadScript(const std::string& path);
+    std::string getScriptError() const;
+    
+    // Parallel update (threads including the caller; <= 1 runs serially)
+    void setWorkerCount(size_t worker_count);
+    
+    // Time source (defaults to common::systemClock(); pass a VirtualClock
+    // to run faster than real time)
+    void setClock(common::Clock* clock);
+    
+    // Fixed seed for reproducible runs (applies from the next setScenario)
+    void setRandomSeed(uint64_t seed);
+    
+    // Recording: every updateTracks() appends one frame of active tracks
+    bool startRecording(const std::string& path);
+    bool stopRecording();
+    bool isRecording() const;
+    
     // Track state access (for testing)
-    const std::vector<TrackState>& getTrackStates() const { return track_states_; }
+    const TrackStore& getTrackStore() const { return track_store_; }
     size_t getActiveTrackCount() const;
+    bool findTrack(uint32_t track_id, c2::Track& track) const; // O(1) lookup by id
+    
+    // Per-cycle update timing (capacity planning)
+    CycleStats getCycleStats() const;
 
 private:
-    std::vector<TrackState> track_states_;
+    TrackStore track_store_;
+    mutable std::mutex mutex_;
     std::unique_ptr<ScenarioManager> scenario_manager_;
-    std::chrono::steady_clock::time_point last_update_time_;
+    common::Clock* clock_;
+    double last_update_time_s_;
+    uint64_t cycle_count_;
+    std::unique_ptr<TrackRecorder> recorder_;
+    SensorModel sensor_model_;
     bool initialized_;
     
+    // Published picture: front buffer is read, back buffer is refilled.
+    // Both keep their capacity, so steady-state publishes do not allocate.
+    // Filled lazily by refreshSnapshot() when the published generation is
+    // newer than the converted one.
+    mutable std::vector<c2::Track> snapshot_buffers_[2];
+    mutable size_t snapshot_front_;
+    mutable uint64_t snapshot_generation_;
+    mutable double snapshot_time_s_;
+    uint64_t published_generation_;
+    double published_time_s_;
+    
     void initialize();
+    void publishSnapshot();        // Caller holds mutex_
+    void refreshSnapshot() const;  // Caller holds mutex_
 };
 
 } // namespace radar
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+namespace skyguardis {
+namespace radar {
+
+// Fixed-capacity ring buffer stored inline (no heap allocation).
+// push_back() overwrites the oldest element once the buffer is full.
+// Elements are indexed oldest-first: [0] is the oldest, [size() - 1] the newest.
+// Trivially copyable whenever T is.
+template <typename T, size_t Capacity>
+class RingBuffer {
+    static_assert(Capacity > 0, "RingBuffer capacity must be non-zero");
+
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : buffer_(nullptr), index_(0) {}
+        const_iterator(const RingBuffer* buffer, size_t index) : buffer_(buffer), index_(index) {}
+
+        reference operator*() const { return (*buffer_)[index_]; }
+        pointer operator->() const { return &(*buffer_)[index_]; }
+        reference operator[](difference_type n) const { return (*buffer_)[index_ + n]; }
+
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index_; return tmp; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --index_; return tmp; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(buffer_, index_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(buffer_, index_ - n); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+
+    private:
+        const RingBuffer* buffer_;
+        size_t index_;
+    };
+
+    RingBuffer() : head_(0), count_(0) {}
+
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    bool full() const { return count_ == Capacity; }
+
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    void push_back(const T& value) {
+        size_t tail = head_ + count_;
+        if (tail >= Capacity) tail -= Capacity;
+        data_[tail] = value;
+        if (count_ < Capacity) {
+            ++count_;
+        } else {
+            head_ = (head_ + 1 == Capacity) ? 0 : head_ + 1;
+        }
+    }
+
+    const T& operator[](size_t index) const {
+        size_t slot = head_ + index;
+        if (slot >= Capacity) slot -= Capacity;
+        return data_[slot];
+    }
+
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[count_ - 1]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count_); }
+
+private:
+    std::array<T, Capacity> data_;
+    size_t head_;   // Slot of the oldest element
+    size_t count_;
+};
+
+} // namespace radar
+} // namespace skyguardis
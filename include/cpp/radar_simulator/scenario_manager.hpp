@@ -1,10 +1,17 @@
 #pragma once
 
+#include "common/sim_clock.hpp"
+#include "radar_simulator/counter_rng.hpp"
 #include "radar_simulator/track_state.hpp"
+#include "radar_simulator/track_store.hpp"
+#include "radar_simulator/trajectory_table.hpp"
+#include "radar_simulator/worker_pool.hpp"
 #include <vector>
 #include <string>
 #include <memory>
-#include <random>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 
 namespace skyguardis {
 namespace radar {
@@ -13,9 +20,15 @@ namespace radar {
 enum class ScenarioType {
     SINGLE_TARGET,   // One object moving through engagement zone
     SWARM,           // Multiple objects (3-10) simultaneously
-    SATURATION       // Many objects (10-20) with high update rate
+    SATURATION,      // Many objects (10-20) with high update rate
+    MASS_RAID,       // Thousands to a million objects arriving in staged waves
+    SCRIPTED         // Tracks replayed from a loaded scenario script (see TrajectoryTable)
 };
 
+// Target count limits for the mass raid scenario
+static constexpr uint32_t MASS_RAID_MIN_TARGETS = 1000;
+static constexpr uint32_t MASS_RAID_MAX_TARGETS = 1000000;
+
 // Scenario configuration
 struct ScenarioConfig {
     ScenarioType type;
@@ -28,6 +41,12 @@ struct ScenarioConfig {
     double max_elevation_rad;
     double detection_zone_radius_m;
     
+    // Arrival of new tracks
+    double spawn_probability;     // SWARM/SATURATION: chance per cycle to add a track
+    double spawn_rate_per_s;      // MASS_RAID: tracks released per second per wave (<= 0: whole wave at once)
+    uint32_t wave_count;          // MASS_RAID: number of arrival waves target_count is split into
+    double wave_interval_s;       // MASS_RAID: simulated time between wave starts
+    
     ScenarioConfig() : type(ScenarioType::SINGLE_TARGET),
                        target_count(1),
                        min_range_m(1000.0),
@@ -36,7 +55,26 @@ struct ScenarioConfig {
                        max_velocity_ms(300.0),
                        min_elevation_rad(-0.5),
                        max_elevation_rad(0.5),
-                       detection_zone_radius_m(15000.0) {}
+                       detection_zone_radius_m(15000.0),
+                       spawn_probability(0.1),
+                       spawn_rate_per_s(0.0),
+                       wave_count(1),
+                       wave_interval_s(10.0) {}
+};
+
+// Per-cycle timing of ScenarioManager::updateTracks
+struct CycleStats {
+    uint64_t cycles;              // Number of timed update cycles
+    double last_update_ms;        // Wall time of the most recent cycle
+    double max_update_ms;         // Worst cycle since the scenario started
+    double total_update_ms;       // Sum over all cycles
+    size_t last_track_count;      // Tracks in the store after the most recent cycle
+    uint64_t tracks_spawned;      // Tracks created since the scenario started
+    
+    CycleStats() : cycles(0), last_update_ms(0.0), max_update_ms(0.0),
+                   total_update_ms(0.0), last_track_count(0), tracks_spawned(0) {}
+    
+    double meanUpdateMs() const { return cycles > 0 ? total_update_ms / cycles : 0.0; }
 };
 
 class ScenarioManager {
@@ -50,34 +88,106 @@ public:
     
     // Track generation
     std::vector<TrackState> generateInitialTracks();
+    void generateInitialTracks(TrackStore& store);
     void updateTracks(std::vector<TrackState>& tracks, double delta_time_s);
+    void updateTracks(TrackStore& store, double delta_time_s);
     
     // Track lifecycle
     void addNewTrack(std::vector<TrackState>& tracks, uint32_t& next_id);
+    void addNewTrack(TrackStore& store, uint32_t& next_id);
     void removeOutOfBoundsTracks(std::vector<TrackState>& tracks);
+    void removeOutOfBoundsTracks(TrackStore& store);
     bool isTrackInBounds(const TrackState& track) const;
+    bool isTrackInBounds(const TrackStore& store, size_t index) const;
     
     // Motion model application
     void applyMotionModel(TrackState& track, double delta_time_s);
     void applyLinearMotion(TrackState& track, double delta_time_s);
     void applyManeuveringMotion(TrackState& track, double delta_time_s);
+    void applyMotionModel(TrackStore& store, double delta_time_s);
+    
+    // Scripted scenarios: load before setScenario(ScenarioType::SCRIPTED).
+    // Scripted tracks spawn on the script's schedule, are reported (active)
+    // only while inside the detection zone and leave at their last waypoint.
+    bool loadScript(const std::string& path);
+    const TrajectoryTable& getScript() const { return script_; }
     
     // Configuration
     ScenarioConfig getConfig() const { return current_config_; }
-    void setConfig(const ScenarioConfig& config) { current_config_ = config; }
+    void setConfig(const ScenarioConfig& config);
+    
+    // Parallel columnar update. The track store is cut into fixed blocks of
+    // UPDATE_BLOCK_SIZE tracks; random draws are keyed by (seed, track id,
+    // cycle), so results do not depend on the worker count. Rows are kept
+    // bucketed by motion model (maneuvering rows first) so each bucket runs
+    // its own kernel without per-track dispatch.
+    static constexpr size_t UPDATE_BLOCK_SIZE = 4096;
+    void setWorkerCount(size_t worker_count); // Threads including the caller; <= 1 runs serially
+    size_t getWorkerCount() const;
+    void setRandomSeed(uint64_t seed); // Replays an identical run when set before setScenario
+    uint64_t getRandomSeed() const { return random_seed_; }
+    
+    // Time source for track timestamps (defaults to common::systemClock()).
+    // Cycle timing in CycleStats always measures real elapsed time.
+    void setClock(common::Clock* clock);
+    
+    // Timing
+    const CycleStats& getCycleStats() const { return cycle_stats_; }
+    double getScenarioElapsedTime() const { return scenario_elapsed_s_; }
 
 private:
     ScenarioConfig current_config_;
+    common::Clock* clock_;
     uint32_t next_track_id_;
     double scenario_start_time_s_;
+    double scenario_elapsed_s_;     // Simulated time since setScenario
+    uint64_t tracks_released_;      // Mass raid tracks released so far
+    
+    // Scripted scenario and index of its next track to spawn
+    TrajectoryTable script_;
+    size_t next_scripted_track_;
+    CycleStats cycle_stats_;
+    
+    // Random number generation (counter-based, see CounterRng)
+    uint64_t random_seed_;
+    uint64_t motion_cycle_;         // Motion passes since setScenario, keys the draws
     
-    // Random number generation
-    std::mt19937 random_generator_;
+    // Elevation bounds as sines for the Cartesian bounds test
+    double sin_min_elevation_;
+    double sin_max_elevation_;
+    
+    // Workers for the columnar update (null when serial)
+    std::unique_ptr<WorkerPool> worker_pool_;
+    
+    // Scratch keep flags for bounds removal, reused across cycles
+    std::vector<uint8_t> keep_mask_;
+    std::vector<uint8_t> block_removed_;
     
     // Helper functions
     TrackState createRandomTrack(uint32_t id);
     double getCurrentTime() const;
     void initializeRandomGenerator();
+    bool shouldSpawnTrack(size_t track_count);
+    size_t tracksDue() const;
+    void addNewTracks(TrackStore& store, size_t count);
+    size_t scriptedTracksDue() const;
+    TrackState createScriptedTrack(size_t script_index, EnuState& state);
+    void addScriptedTracks(std::vector<TrackState>& tracks, size_t count);
+    void addScriptedTracks(TrackStore& store, size_t count);
+    bool playbackTrack(TrackState& track);
+    void playbackBlock(TrackStore& store, size_t begin, size_t end);
+    void recordCycle(std::chrono::steady_clock::time_point start, size_t track_count);
+    bool isInBounds(double range_m, double elevation_rad) const;
+    void updateBoundsCache();
+    void maybeChangeManeuver(uint32_t track_id, double& acceleration_ms2,
+                             double& angular_velocity_rads);
+    
+    // Block-parallel helpers for the columnar path
+    void forEachBlock(size_t count, const std::function<void(size_t, size_t, size_t)>& body);
+    size_t partitionByMotionModel(TrackStore& store);
+    void advanceBlock(TrackStore& store, size_t begin, size_t end, size_t maneuver_end,
+                      double delta_time_s);
+    void changeManeuvers(TrackStore& store, size_t begin, size_t end);
 };
 
 } // namespace radar
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "radar_simulator/track_store.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+// Sensor noise applied to plots (1 sigma; zero gives perfect plots)
+struct MeasurementNoise {
+    double range_sigma_m;
+    double azimuth_sigma_rad;
+    double elevation_sigma_rad;
+
+    MeasurementNoise() : range_sigma_m(25.0),
+                         azimuth_sigma_rad(0.0035),
+                         elevation_sigma_rad(0.0035) {}
+};
+
+struct SensorConfig {
+    // Sensor position in the scenario's ENU frame; plots are measured
+    // from here. Sensors scanning the same scenario need distinct ids so
+    // their noise is independent.
+    double site_east_m;
+    double site_north_m;
+    double site_up_m;
+    uint32_t sensor_id;
+
+    MeasurementNoise noise;
+    double detection_probability;     // Pd: chance that a track produces a plot each scan
+
+    // False alarms: a Poisson number per scan, spread uniformly in range,
+    // azimuth and elevation over the clutter volume
+    double false_alarms_per_scan;     // Mean of the Poisson count (0 disables clutter)
+    double clutter_min_range_m;
+    double clutter_max_range_m;
+    double clutter_min_elevation_rad;
+    double clutter_max_elevation_rad;
+
+    SensorConfig() : site_east_m(0.0),
+                     site_north_m(0.0),
+                     site_up_m(0.0),
+                     sensor_id(0),
+                     detection_probability(1.0),
+                     false_alarms_per_scan(0.0),
+                     clutter_min_range_m(1000.0),
+                     clutter_max_range_m(15000.0),
+                     clutter_min_elevation_rad(0.0),
+                     clutter_max_elevation_rad(0.5) {}
+};
+
+// Plots produced by the last scan
+struct SensorStats {
+    size_t detections;            // Plots of real tracks
+    size_t missed;                // Active tracks not detected (Pd < 1)
+    size_t false_alarms;          // Clutter plots
+
+    SensorStats() : detections(0), missed(0), false_alarms(0) {}
+};
+
+// Turns the simulated truth into what a radar reports: each active track
+// is detected with probability Pd and measured with Gaussian noise, and a
+// Poisson number of false alarms (track_id c2::FALSE_ALARM_ID) is added.
+// Every draw is keyed by (seed, id, cycle) through CounterRng, so a scan
+// replays exactly. Clutter is generated in batches: the Philox rounds for
+// a run of false alarms are computed lane-wise over stack columns, which
+// the compiler vectorises, then scaled straight into the output plots.
+// The output vector keeps its capacity, so a steady clutter load does not
+// allocate.
+class SensorModel {
+public:
+    SensorModel();
+    explicit SensorModel(const SensorConfig& config);
+
+    void setConfig(const SensorConfig& config);
+    const SensorConfig& getConfig() const { return config_; }
+
+    // Plots of one scan of `store`: detections in row order, then clutter.
+    // Fills `plots` in place.
+    void scan(const TrackStore& store, uint64_t seed, uint64_t cycle,
+              std::vector<c2::Measurement>& plots);
+
+    const SensorStats& getStats() const { return stats_; }
+
+    // Poisson-distributed count for one scan (exact below 64, normal
+    // approximation above)
+    static size_t poissonCount(uint64_t seed, uint64_t cycle, double mean);
+
+private:
+    static constexpr size_t CLUTTER_BATCH = 256;  // False alarms per Philox batch
+
+    SensorConfig config_;
+    SensorStats stats_;
+
+    void generateClutter(uint64_t seed, uint64_t cycle, c2::Measurement* out, size_t count);
+};
+
+} // namespace radar
+} // namespace skyguardis
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "radar_simulator/sensor_model.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+class RadarSimulator;
+
+// One radar of a SensorNetwork
+struct SensorSpec {
+    SensorConfig sensor;          // Site, noise, Pd and clutter
+    double scan_period_s;         // Time between scans
+    double latency_s;             // Delay from measurement to delivery at the C2
+
+    SensorSpec() : scan_period_s(0.1), latency_s(0.0) {}
+};
+
+// Plots of one scan, stamped with the time they were measured
+struct SensorReport {
+    uint32_t sensor;              // Index returned by SensorNetwork::addSensor
+    double time_s;                // Measurement time
+    std::vector<c2::Measurement> plots;  // Spherical, relative to the sensor's site
+};
+
+// Several radars at different sites watching one simulated scenario.
+// Each sensor scans on its own period; its reports are held back for its
+// latency before the C2 can collect them, so a sensor's reports arrive in
+// measurement order but reports from different sensors interleave.
+class SensorNetwork {
+public:
+    // Returns the sensor index (also written to the sensor's sensor_id)
+    uint32_t addSensor(const SensorSpec& spec);
+    size_t size() const { return specs_.size(); }
+    const SensorSpec& getSpec(uint32_t sensor) const { return specs_[sensor]; }
+    void clear();
+
+    // Scans the radar's current truth with every sensor due by time_s.
+    // Call after each RadarSimulator::updateTracks.
+    void scan(const RadarSimulator& radar, double time_s);
+
+    // Moves the reports delivered by time_s into `reports`, in
+    // measurement time order
+    void collect(double time_s, std::vector<SensorReport>& reports);
+    size_t pendingCount() const { return pending_.size(); }
+
+private:
+    std::vector<SensorSpec> specs_;
+    std::vector<SensorModel> models_;
+    std::vector<double> next_scan_s_;
+    std::vector<uint8_t> started_;
+    std::vector<SensorReport> pending_;
+};
+
+} // namespace radar
+} // namespace skyguardis
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "radar_simulator/track_store.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+// Binary track recording format (native byte order):
+//
+//   RecordingHeader
+//   frame 0: FrameHeader, track_count x c2::Track
+//   frame 1: ...
+//   index:   frame_count x uint64_t (file offset of each FrameHeader)
+//
+// Tracks are stored as raw c2::Track records so a memory-mapped replay can
+// hand them out in place. Every block is 8-byte aligned.
+namespace recording {
+
+static constexpr char MAGIC[8] = {'S', 'K', 'Y', 'R', 'E', 'C', '0', '1'};
+static constexpr uint32_t VERSION = 1;
+
+struct RecordingHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t track_record_size;   // sizeof(c2::Track) of the writer
+    uint64_t frame_count;
+    uint64_t index_offset;        // 0 until the recording is closed
+};
+
+struct FrameHeader {
+    uint64_t cycle;
+    double time_s;
+    uint32_t track_count;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(RecordingHeader) == 32, "RecordingHeader layout");
+static_assert(sizeof(FrameHeader) == 24, "FrameHeader layout");
+static_assert(sizeof(c2::Track) % 8 == 0, "c2::Track records must keep 8-byte alignment");
+
+} // namespace recording
+
+// Appends per-cycle track frames to a recording file
+class TrackRecorder {
+public:
+    TrackRecorder();
+    ~TrackRecorder();
+    
+    bool open(const std::string& path);
+    bool isOpen() const { return file_.is_open(); }
+    
+    // Write one frame; the columnar overload records active tracks only
+    bool writeFrame(uint64_t cycle, double time_s, const std::vector<c2::Track>& tracks);
+    bool writeFrame(uint64_t cycle, double time_s, const TrackStore& store);
+    
+    // Write the frame index and finalise the header
+    bool close();
+    
+    uint64_t frameCount() const { return frame_offsets_.size(); }
+
+private:
+    std::ofstream file_;
+    std::vector<uint64_t> frame_offsets_;
+    std::vector<c2::Track> staging_;   // Reused gather buffer, zeroed padding
+    uint64_t write_offset_;
+    
+    bool writeFrame(uint64_t cycle, double time_s, const c2::Track* tracks, size_t count);
+};
+
+// Read-only view of one recorded frame (points into the mapped file)
+struct FrameView {
+    uint64_t cycle;
+    double time_s;
+    const c2::Track* tracks;
+    size_t count;
+    
+    const c2::Track* begin() const { return tracks; }
+    const c2::Track* end() const { return tracks + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const c2::Track& operator[](size_t index) const { return tracks[index]; }
+    operator c2::TrackSpan() const { return c2::TrackSpan(tracks, count); }
+};
+
+// Memory-maps a closed recording and serves its frames without copying
+class TrackReplay {
+public:
+    TrackReplay();
+    ~TrackReplay();
+    
+    TrackReplay(const TrackReplay&) = delete;
+    TrackReplay& operator=(const TrackReplay&) = delete;
+    
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return data_ != nullptr; }
+    
+    size_t frameCount() const { return frame_count_; }
+    FrameView frame(size_t index) const;
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    const uint64_t* index_;
+    size_t frame_count_;
+};
+
+} // namespace radar
+} // namespace skyguardis
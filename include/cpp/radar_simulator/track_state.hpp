@@ -1,9 +1,11 @@
 #pragma once
 
 #include "c2_controller/threat_evaluator.hpp"
+#include "common/enu_frame.hpp"
+#include "radar_simulator/ring_buffer.hpp"
 #include <chrono>
-#include <vector>
-#include <memory>
+#include <cstdint>
+#include <type_traits>
 
 namespace skyguardis {
 namespace radar {
@@ -14,6 +16,17 @@ enum class MotionModel {
     MANEUVERING  // Velocity changes with acceleration
 };
 
+// Kinematic state in the radar-centred East-North-Up frame
+using EnuState = common::EnuState;
+
+// Fixed-capacity position history
+static constexpr size_t TRACK_HISTORY_CAPACITY = 10;
+using TrackHistory = RingBuffer<c2::Track, TRACK_HISTORY_CAPACITY>;
+using EnuHistory = RingBuffer<EnuState, TRACK_HISTORY_CAPACITY>;
+
+// Marks a track that is not following a scripted trajectory
+static constexpr uint32_t NO_TRAJECTORY = UINT32_MAX;
+
 // Track state with history and motion model
 struct TrackState {
     c2::Track track;
@@ -29,9 +42,13 @@ struct TrackState {
     uint32_t age_cycles;          // Number of cycles track has existed
     double entry_time_s;          // Time when track entered detection zone
     
-    // Position history (for prediction)
-    std::vector<c2::Track> history;
-    static constexpr size_t MAX_HISTORY = 10;
+    // Scripted playback (see TrajectoryTable)
+    uint32_t trajectory;          // Index of the scripted track, or NO_TRAJECTORY
+    uint32_t trajectory_leg;      // Playback cursor into the trajectory table
+    
+    // Position history (for prediction), oldest first
+    TrackHistory history;
+    static constexpr size_t MAX_HISTORY = TRACK_HISTORY_CAPACITY;
     
     TrackState() : motion_model(MotionModel::LINEAR),
                    acceleration_ms2(0.0),
@@ -39,9 +56,14 @@ struct TrackState {
                    last_update_time_s(0.0),
                    active(true),
                    age_cycles(0),
-                   entry_time_s(0.0) {}
+                   entry_time_s(0.0),
+                   trajectory(NO_TRAJECTORY),
+                   trajectory_leg(UINT32_MAX) {}
 };
 
+static_assert(std::is_trivially_copyable<TrackState>::value,
+              "TrackState must stay trivially copyable");
+
 } // namespace radar
 } // namespace skyguardis
 
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "c2_controller/threat_evaluator.hpp"
+#include "radar_simulator/track_state.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+// Stable reference to a track in a TrackStore.
+// Rows move when other tracks are removed; a handle keeps resolving to the
+// same track until that track is removed, and to nothing afterwards.
+struct TrackHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+// Columnar (structure-of-arrays) track storage.
+// Each field of TrackState lives in its own contiguous array so the
+// per-cycle update passes stream through memory instead of hopping between
+// scattered TrackState objects. All columns always have the same length.
+//
+// Kinematics are kept as Cartesian ENU position/velocity so propagation is
+// plain multiply-adds; the spherical c2::Track fields are derived only when
+// a row is read through track() or get().
+//
+// Rows are kept dense: removal moves the last row into the hole
+// (swap-and-pop), so row order is not stable. A slot table behind the
+// columns maps generational handles and track ids to rows in O(1).
+// Track ids are expected to be unique within a store.
+struct TrackStore {
+    // Kinematics (hot: touched every cycle)
+    std::vector<uint32_t> id;
+    std::vector<double> east_m;
+    std::vector<double> north_m;
+    std::vector<double> up_m;
+    std::vector<double> vel_east_ms;
+    std::vector<double> vel_north_ms;
+    std::vector<double> vel_up_ms;
+
+    // Motion parameters
+    std::vector<MotionModel> motion_model;
+    std::vector<double> acceleration_ms2;
+    std::vector<double> angular_velocity_rads;
+
+    // Lifecycle
+    std::vector<uint8_t> active;
+    std::vector<uint32_t> age_cycles;
+    std::vector<double> last_update_time_s;
+    std::vector<double> entry_time_s;
+
+    // Scripted playback (NO_TRAJECTORY for simulated tracks)
+    std::vector<uint32_t> trajectory;
+    std::vector<uint32_t> trajectory_leg;
+
+    // Position history (cold: appended once per cycle, never scanned)
+    std::vector<EnuHistory> history;
+
+    // Slot owning each row (see TrackHandle)
+    std::vector<uint32_t> slot;
+
+    size_t size() const { return id.size(); }
+    bool empty() const { return id.empty(); }
+
+    void reserve(size_t capacity);
+    void clear();
+
+    // Row access (gather/scatter between a TrackState and the columns).
+    // Spherical rows are converted with common::toEnu / common::toSpherical.
+    TrackHandle push_back(const TrackState& state);
+    TrackState get(size_t index) const;
+    void set(size_t index, const TrackState& state);
+    c2::Track track(size_t index) const;
+    EnuState enu(size_t index) const;
+    void setEnu(size_t index, const EnuState& state);
+
+    // Lookup: false when the track is no longer (or never was) in the store
+    TrackHandle handle(size_t index) const;
+    bool resolve(TrackHandle handle, size_t& index) const;
+    bool find(uint32_t track_id, size_t& index) const;
+
+    // Removal (swap-and-pop). remove() moves the last row into `index`;
+    // retain() drops every row whose keep flag is zero, touching only the
+    // removed rows and the rows moved into their place.
+    void remove(size_t index);
+    void retain(const std::vector<uint8_t>& keep);
+
+    // Exchanges two rows; handles and id lookups follow their tracks
+    void swapRows(size_t a, size_t b);
+
+    size_t activeCount() const;
+
+private:
+    // Slot table: row and generation per slot, plus recycled slots
+    std::vector<uint32_t> slot_row_;
+    std::vector<uint32_t> slot_generation_;
+    std::vector<uint32_t> free_slots_;
+    std::unordered_map<uint32_t, uint32_t> id_slot_;
+};
+
+} // namespace radar
+} // namespace skyguardis
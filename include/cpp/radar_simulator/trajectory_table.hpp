@@ -0,0 +1,83 @@
+#pragma once
+
+#include "radar_simulator/track_state.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+// Scripted track: one entry per track id in a loaded scenario script
+struct ScriptedTrack {
+    uint32_t track_id;
+    uint32_t path;                // Index of the compiled path it follows
+    double spawn_time_s;          // Scenario time at which the track appears
+    double offset_east_m;         // Added to every position on the path
+    double offset_north_m;
+    double offset_up_m;
+};
+
+// Scenario script compiled into piecewise-linear trajectory tables.
+//
+// Script format, one directive per line ('#' starts a comment):
+//
+//   track <id> spawn <time_s> [count <n> every <interval_s>] [spacing <east_m> <north_m> <up_m>]
+//   waypoint <east_m> <north_m> <up_m>               (first: spawn position)
+//   waypoint <east_m> <north_m> <up_m> <speed_ms>    (next: reached at speed_ms)
+//   end
+//
+// Positions are in the radar-centred ENU frame. `count` expands the block
+// into n tracks with ids id .. id + n - 1, spawned interval_s apart, copy k
+// shifted by k * spacing; all copies share one compiled path.
+//
+// Loading turns every path into straight legs with precomputed start times
+// and velocities, so the state at any time is a leg lookup and one
+// multiply-add per axis instead of an integration.
+class TrajectoryTable {
+public:
+    static constexpr uint32_t NO_LEG = UINT32_MAX;
+
+    TrajectoryTable();
+
+    // Replace the table with a parsed script; on failure the table is empty
+    // and getError() names the offending line.
+    bool load(const std::string& path);
+    bool parse(std::istream& input);
+    void clear();
+    const std::string& getError() const { return error_; }
+
+    // Scripted tracks, sorted by spawn time (ties keep script order)
+    size_t trackCount() const { return tracks_.size(); }
+    const ScriptedTrack& track(size_t index) const { return tracks_[index]; }
+    bool empty() const { return tracks_.empty(); }
+
+    size_t pathCount() const { return path_first_leg_.size(); }
+    double pathDuration(uint32_t path) const { return path_duration_s_[path]; }
+
+    // State of a scripted track `time_s` seconds after its spawn.
+    // `leg` is a playback cursor: start at NO_LEG and pass the previous value
+    // back in, so monotonic playback finds its leg in O(1). Returns false once
+    // the track has passed its last waypoint (state is then the end point).
+    bool sample(const ScriptedTrack& track, double time_s, uint32_t& leg, EnuState& state) const;
+
+private:
+    // Legs of all paths, flattened; a leg's state is its start position
+    // (relative to the track offset) and its constant velocity
+    std::vector<double> leg_start_s_;
+    std::vector<EnuState> leg_state_;
+
+    std::vector<uint32_t> path_first_leg_;
+    std::vector<uint32_t> path_leg_count_;
+    std::vector<double> path_duration_s_;
+
+    std::vector<ScriptedTrack> tracks_;
+    std::string error_;
+
+    bool fail(size_t line, const std::string& message);
+};
+
+} // namespace radar
+} // namespace skyguardis
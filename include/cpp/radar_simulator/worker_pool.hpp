@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace skyguardis {
+namespace radar {
+
+// Persistent pool of worker threads for data-parallel loops.
+// The threads are started once and parked between jobs, so dispatching a
+// per-cycle loop costs a wake-up rather than a thread spawn. The calling
+// thread takes part in every job, so a pool of N threads keeps N + 1 cores busy.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t thread_count);
+    ~WorkerPool();
+    
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    
+    // Number of background threads (excluding the caller)
+    size_t threadCount() const { return threads_.size(); }
+    
+    // Run task(i) for every i in [0, task_count) and wait for all of them.
+    // Tasks are handed out dynamically; their execution order is unspecified.
+    void parallelFor(size_t task_count, const std::function<void(size_t)>& task);
+
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    
+    // Current job (guarded by mutex_ except for the atomics)
+    const std::function<void(size_t)>* task_;
+    size_t task_count_;
+    std::atomic<size_t> next_task_;
+    size_t busy_workers_;
+    uint64_t generation_;
+    bool stopping_;
+    
+    void workerLoop();
+    void runTasks();
+};
+
+} // namespace radar
+} // namespace skyguardis
@@ -1,5 +1,6 @@
 #include "c2_controller/c2_controller.hpp"
 #include "c2_controller/threat_evaluator.hpp"
+#include "common/alloc_tracker.hpp"
 #include "message_gateway/protocol.hpp"
 #include "message_gateway/message_gateway.hpp"
 #include <iostream>
@@ -7,7 +8,7 @@
 namespace skyguardis {
 namespace c2 {
 
-C2Controller::C2Controller() : gateway_(nullptr) {
+C2Controller::C2Controller() : gateway_(nullptr), arena_(nullptr) {
 }
 
 C2Controller::~C2Controller() {
@@ -17,27 +18,33 @@ void C2Controller::setMessageGateway(gateway::MessageGateway* gateway) {
     gateway_ = gateway;
 }
 
-void C2Controller::processTracks(const std::vector<Track>& tracks) {
+void C2Controller::processTracks(TrackSpan tracks) {
     if (tracks.empty()) {
         return;
     }
     
-    // Evaluate and prioritize threats
-    auto prioritized = evaluator_.prioritize(tracks);
+    // Evaluate threats; only the highest is acted on, so select it rather
+    // than sorting the whole picture
+    common::ArenaVector<ThreatEvaluator::ThreatScore> prioritized(
+        (common::ArenaAllocator<ThreatEvaluator::ThreatScore>(arena_)));
+    {
+        common::AllocationPhase phase(common::CyclePhase::THREAT_EVALUATION);
+        evaluator_.topK(tracks, 1, prioritized);
+    }
     
     // Assign highest priority target if score exceeds threshold
+    common::AllocationPhase phase(common::CyclePhase::ASSIGNMENT);
     if (!prioritized.empty() && prioritized[0].score > 0.5) {
-        // Find the track with highest priority
-        for (const auto& track : tracks) {
-            if (track.id == prioritized[0].track_id) {
-                assignTarget(track);
-                break;
-            }
-        }
+        const auto& best = prioritized[0];
+        assignTarget(tracks[best.track_index], best);
     }
 }
 
 void C2Controller::assignTarget(const Track& track) {
+    assignTarget(track, evaluator_.evaluate(track));
+}
+
+void C2Controller::assignTarget(const Track& track, const ThreatEvaluator::ThreatScore& score) {
     if (!gateway_ || !gateway_->isInitialized()) {
         return;
     }
@@ -49,9 +56,6 @@ void C2Controller::assignTarget(const Track& track) {
     assignment.azimuth_rad = track.azimuth_rad;
     assignment.elevation_rad = track.elevation_rad;
     assignment.velocity_ms = track.velocity_ms;
-    
-    // Get priority from threat evaluation
-    auto score = evaluator_.evaluate(track);
     assignment.priority = score.priority;
     
     // Send via gateway
@@ -0,0 +1,140 @@
+#include "c2_controller/closest_approach.hpp"
+#include "common/kernel_isa.hpp"
+#include "common/simd_trig.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+constexpr double MIN_SCALED_SPEED_MS = 1e-9; // Keeps a stationary track finite
+
+// Closest approach to the radar (the origin) of a track holding its speed
+// and heading in level flight. The track closes on the radar while its
+// heading points back across its bearing, cos(azimuth - heading) < 0.
+inline void approachOne(double range_m, double azimuth_rad, double elevation_rad,
+                        double velocity_ms, double heading_rad,
+                        double& miss_distance_m, double& time_to_go_s, double& closing_speed_ms) {
+    const double cos_offset = std::cos(azimuth_rad - heading_rad);
+    const double cos_elevation = std::cos(elevation_rad);
+    // Distance still to fly to the closest point (0 once past it)
+    const double along_m = range_m * cos_elevation * std::max(0.0, -cos_offset);
+    time_to_go_s = along_m / std::max(velocity_ms, MIN_SCALED_SPEED_MS);
+    miss_distance_m = std::sqrt(std::max(0.0, range_m * range_m - along_m * along_m));
+    closing_speed_ms = -velocity_ms * cos_offset * cos_elevation;
+}
+
+#ifdef SKYGUARDIS_X86_KERNELS
+
+// ---- AVX2 / FMA: 4 tracks per iteration ----
+
+__attribute__((target("avx2,fma")))
+size_t closestApproachAvx2(const double* range_m, const double* azimuth_rad,
+                           const double* elevation_rad, const double* velocity_ms,
+                           const double* heading_rad, double* miss_distance_m,
+                           double* time_to_go_s, double* closing_speed_ms, size_t count) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d min_scaled = _mm256_set1_pd(MIN_SCALED_SPEED_MS);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d range = _mm256_loadu_pd(range_m + i);
+        const __m256d speed = _mm256_loadu_pd(velocity_ms + i);
+
+        __m256d sin_offset, cos_offset, sin_elevation, cos_elevation;
+        common::sincos4(_mm256_sub_pd(_mm256_loadu_pd(azimuth_rad + i),
+                                      _mm256_loadu_pd(heading_rad + i)),
+                        sin_offset, cos_offset);
+        common::sincos4(_mm256_loadu_pd(elevation_rad + i), sin_elevation, cos_elevation);
+
+        const __m256d along = _mm256_mul_pd(_mm256_mul_pd(range, cos_elevation),
+                                            _mm256_max_pd(zero, _mm256_sub_pd(zero, cos_offset)));
+        const __m256d miss = _mm256_sqrt_pd(_mm256_max_pd(zero,
+                                 _mm256_fnmadd_pd(along, along, _mm256_mul_pd(range, range))));
+
+        _mm256_storeu_pd(time_to_go_s + i, _mm256_div_pd(along, _mm256_max_pd(speed, min_scaled)));
+        _mm256_storeu_pd(miss_distance_m + i, miss);
+        _mm256_storeu_pd(closing_speed_ms + i,
+                         _mm256_mul_pd(_mm256_mul_pd(_mm256_sub_pd(zero, speed), cos_offset),
+                                       cos_elevation));
+    }
+    return i;
+}
+
+// ---- SSE4.1: 2 tracks per iteration ----
+
+__attribute__((target("sse4.1")))
+size_t closestApproachSse41(const double* range_m, const double* azimuth_rad,
+                            const double* elevation_rad, const double* velocity_ms,
+                            const double* heading_rad, double* miss_distance_m,
+                            double* time_to_go_s, double* closing_speed_ms, size_t count) {
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d min_scaled = _mm_set1_pd(MIN_SCALED_SPEED_MS);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d range = _mm_loadu_pd(range_m + i);
+        const __m128d speed = _mm_loadu_pd(velocity_ms + i);
+
+        __m128d sin_offset, cos_offset, sin_elevation, cos_elevation;
+        common::sincos2(_mm_sub_pd(_mm_loadu_pd(azimuth_rad + i), _mm_loadu_pd(heading_rad + i)),
+                        sin_offset, cos_offset);
+        common::sincos2(_mm_loadu_pd(elevation_rad + i), sin_elevation, cos_elevation);
+
+        const __m128d along = _mm_mul_pd(_mm_mul_pd(range, cos_elevation),
+                                         _mm_max_pd(zero, _mm_sub_pd(zero, cos_offset)));
+        const __m128d miss = _mm_sqrt_pd(_mm_max_pd(zero, _mm_sub_pd(_mm_mul_pd(range, range),
+                                                                     _mm_mul_pd(along, along))));
+
+        _mm_storeu_pd(time_to_go_s + i, _mm_div_pd(along, _mm_max_pd(speed, min_scaled)));
+        _mm_storeu_pd(miss_distance_m + i, miss);
+        _mm_storeu_pd(closing_speed_ms + i,
+                      _mm_mul_pd(_mm_mul_pd(_mm_sub_pd(zero, speed), cos_offset), cos_elevation));
+    }
+    return i;
+}
+
+#endif // SKYGUARDIS_X86_KERNELS
+
+} // namespace
+
+ClosestApproach closestApproach(const Track& track) {
+    ClosestApproach approach;
+    approachOne(track.range_m, track.azimuth_rad, track.elevation_rad,
+                track.velocity_ms, track.heading_rad,
+                approach.miss_distance_m, approach.time_to_go_s, approach.closing_speed_ms);
+    return approach;
+}
+
+void closestApproachBatch(const double* range_m, const double* azimuth_rad,
+                          const double* elevation_rad, const double* velocity_ms,
+                          const double* heading_rad, double* miss_distance_m,
+                          double* time_to_go_s, double* closing_speed_ms, size_t count) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = closestApproachAvx2(range_m, azimuth_rad, elevation_rad, velocity_ms,
+                                       heading_rad, miss_distance_m, time_to_go_s,
+                                       closing_speed_ms, count);
+            break;
+        case common::KernelIsa::SSE41:
+            done = closestApproachSse41(range_m, azimuth_rad, elevation_rad, velocity_ms,
+                                        heading_rad, miss_distance_m, time_to_go_s,
+                                        closing_speed_ms, count);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < count; ++i) {
+        approachOne(range_m[i], azimuth_rad[i], elevation_rad[i], velocity_ms[i], heading_rad[i],
+                    miss_distance_m[i], time_to_go_s[i], closing_speed_ms[i]);
+    }
+}
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,250 @@
+#include "c2_controller/plot_associator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+// Covariance column order
+constexpr size_t EE = 0, EN = 1, EU = 2, NN = 3, NU = 4, UU = 5;
+
+constexpr uint32_t NO_OWNER = UINT32_MAX;
+
+// A gate spanning more cells than this is searched by scanning every plot
+constexpr int64_t MAX_GATE_CELLS = 4096;
+
+inline int64_t cellOf(double position_m, double cell_size_m) {
+    return static_cast<int64_t>(std::floor(position_m / cell_size_m));
+}
+
+inline size_t hashCell(int64_t x, int64_t y, int64_t z, size_t mask) {
+    const uint64_t h = static_cast<uint64_t>(x) * 73856093u ^
+                       static_cast<uint64_t>(y) * 19349663u ^
+                       static_cast<uint64_t>(z) * 83492791u;
+    return static_cast<size_t>(h ^ (h >> 29)) & mask;
+}
+
+// Squared Mahalanobis distance of (de, dn, du) under the symmetric S given
+// by its upper triangle; negative when S is not positive definite
+inline double mahalanobis(double de, double dn, double du, const double (&s)[6]) {
+    const double c00 = s[NN] * s[UU] - s[NU] * s[NU];
+    const double c01 = s[EU] * s[NU] - s[EN] * s[UU];
+    const double c02 = s[EN] * s[NU] - s[EU] * s[NN];
+    const double c11 = s[EE] * s[UU] - s[EU] * s[EU];
+    const double c12 = s[EN] * s[EU] - s[EE] * s[NU];
+    const double c22 = s[EE] * s[NN] - s[EN] * s[EN];
+    const double det = s[EE] * c00 + s[EN] * c01 + s[EU] * c02;
+    if (det <= 0.0) {
+        return -1.0;
+    }
+    const double quadratic = c00 * de * de + c11 * dn * dn + c22 * du * du +
+                             2.0 * (c01 * de * dn + c02 * de * du + c12 * dn * du);
+    return quadratic / det;
+}
+
+} // namespace
+
+void PositionSet::resize(size_t count) {
+    east_m.resize(count);
+    north_m.resize(count);
+    up_m.resize(count);
+    for (auto& column : covariance) {
+        column.resize(count);
+    }
+}
+
+void PositionSet::set(size_t index, const double (&position)[3], const double (&matrix)[3][3]) {
+    east_m[index] = position[0];
+    north_m[index] = position[1];
+    up_m[index] = position[2];
+    covariance[EE][index] = matrix[0][0];
+    covariance[EN][index] = matrix[0][1];
+    covariance[EU][index] = matrix[0][2];
+    covariance[NN][index] = matrix[1][1];
+    covariance[NU][index] = matrix[1][2];
+    covariance[UU][index] = matrix[2][2];
+}
+
+PlotAssociator::PlotAssociator() : bucket_mask_(0), max_plot_variance_m2_(0.0) {}
+
+PlotAssociator::PlotAssociator(const AssociatorConfig& config)
+    : config_(config), bucket_mask_(0), max_plot_variance_m2_(0.0) {}
+
+void PlotAssociator::setConfig(const AssociatorConfig& config) {
+    config_ = config;
+}
+
+void PlotAssociator::associate(const PositionSet& tracks, const PositionSet& plots,
+                               std::vector<uint32_t>& plot_for_track) {
+    stats_ = AssociationStats();
+    plot_for_track.assign(tracks.size(), NO_PLOT);
+    if (tracks.size() == 0 || plots.size() == 0) {
+        return;
+    }
+    buildGrid(plots);
+    gate(tracks, plots);
+    auction(tracks.size(), plots.size(), plot_for_track);
+}
+
+void PlotAssociator::buildGrid(const PositionSet& plots) {
+    const size_t count = plots.size();
+
+    // Power-of-two bucket count, about two buckets per plot
+    size_t buckets = 1;
+    while (buckets < 2 * count) {
+        buckets <<= 1;
+    }
+    bucket_mask_ = buckets - 1;
+
+    // Counting sort of the plots by bucket
+    cell_start_.assign(buckets + 1, 0);
+    plot_bucket_.resize(count);
+    max_plot_variance_m2_ = 0.0;
+    for (size_t p = 0; p < count; ++p) {
+        const size_t bucket = hashCell(cellOf(plots.east_m[p], config_.cell_size_m),
+                                       cellOf(plots.north_m[p], config_.cell_size_m),
+                                       cellOf(plots.up_m[p], config_.cell_size_m), bucket_mask_);
+        plot_bucket_[p] = static_cast<uint32_t>(bucket);
+        cell_start_[bucket]++;
+        max_plot_variance_m2_ = std::max(max_plot_variance_m2_,
+                                         plots.covariance[EE][p] + plots.covariance[NN][p] +
+                                         plots.covariance[UU][p]);
+    }
+    // Running totals mark where each bucket ends; filling backwards moves
+    // each mark to where its bucket starts
+    for (size_t b = 1; b < buckets; ++b) {
+        cell_start_[b] += cell_start_[b - 1];
+    }
+    cell_start_[buckets] = static_cast<uint32_t>(count);
+    cell_plots_.resize(count);
+    for (size_t p = count; p-- > 0;) {
+        cell_plots_[--cell_start_[plot_bucket_[p]]] = static_cast<uint32_t>(p);
+    }
+}
+
+void PlotAssociator::gate(const PositionSet& tracks, const PositionSet& plots) {
+    const size_t track_count = tracks.size();
+    const double cell = config_.cell_size_m;
+    arc_start_.resize(track_count + 1);
+    arc_plot_.clear();
+    arc_benefit_.clear();
+    visit_stamp_.assign(plots.size(), 0);
+
+    for (size_t t = 0; t < track_count; ++t) {
+        arc_start_[t] = static_cast<uint32_t>(arc_plot_.size());
+        const double east = tracks.east_m[t];
+        const double north = tracks.north_m[t];
+        const double up = tracks.up_m[t];
+        const uint32_t stamp = static_cast<uint32_t>(t + 1);
+
+        // Tests one plot against this track's gate
+        auto test = [&](uint32_t p) {
+            if (visit_stamp_[p] == stamp) {
+                return; // Reached again through a colliding bucket
+            }
+            visit_stamp_[p] = stamp;
+            double s[6];
+            for (size_t k = 0; k < 6; ++k) {
+                s[k] = tracks.covariance[k][t] + plots.covariance[k][p];
+            }
+            const double distance = mahalanobis(plots.east_m[p] - east, plots.north_m[p] - north,
+                                                plots.up_m[p] - up, s);
+            if (distance >= 0.0 && distance <= config_.gate_chi2) {
+                arc_plot_.push_back(p);
+                arc_benefit_.push_back(config_.gate_chi2 - distance);
+            }
+        };
+
+        // Euclidean reach of the gate: |y|^2 <= gate * largest eigenvalue(S) <= gate * trace(S)
+        const double trace = tracks.covariance[EE][t] + tracks.covariance[NN][t] +
+                             tracks.covariance[UU][t] + max_plot_variance_m2_;
+        const double reach_m = std::sqrt(config_.gate_chi2 * trace);
+        const int64_t x0 = cellOf(east - reach_m, cell), x1 = cellOf(east + reach_m, cell);
+        const int64_t y0 = cellOf(north - reach_m, cell), y1 = cellOf(north + reach_m, cell);
+        const int64_t z0 = cellOf(up - reach_m, cell), z1 = cellOf(up + reach_m, cell);
+        const double cells = static_cast<double>(x1 - x0 + 1) * (y1 - y0 + 1) * (z1 - z0 + 1);
+
+        if (cells > MAX_GATE_CELLS || cells > static_cast<double>(plots.size())) {
+            // Gate wider than the grid pays for: scan every plot
+            for (size_t p = 0; p < plots.size(); ++p) {
+                test(static_cast<uint32_t>(p));
+            }
+        } else {
+            for (int64_t x = x0; x <= x1; ++x) {
+                for (int64_t y = y0; y <= y1; ++y) {
+                    for (int64_t z = z0; z <= z1; ++z) {
+                        const size_t bucket = hashCell(x, y, z, bucket_mask_);
+                        for (uint32_t k = cell_start_[bucket]; k < cell_start_[bucket + 1]; ++k) {
+                            test(cell_plots_[k]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    arc_start_[track_count] = static_cast<uint32_t>(arc_plot_.size());
+    stats_.gated_pairs = arc_plot_.size();
+}
+
+void PlotAssociator::auction(size_t track_count, size_t plot_count,
+                             std::vector<uint32_t>& plot_for_track) {
+    // Forward auction from zero prices. Each track also owns a private
+    // "miss" object worth 0 that nobody else bids on, so a track whose best
+    // plot becomes too expensive settles for the miss and leaves the queue.
+    // Plots that never receive a bid keep price 0, which keeps the result
+    // epsilon-optimal for this asymmetric problem.
+    price_.assign(plot_count, 0.0);
+    owner_.assign(plot_count, NO_OWNER);
+    unassigned_.clear();
+    for (size_t t = track_count; t-- > 0;) {
+        if (arc_start_[t + 1] > arc_start_[t]) {
+            unassigned_.push_back(static_cast<uint32_t>(t));
+        }
+    }
+
+    while (!unassigned_.empty()) {
+        const uint32_t t = unassigned_.back();
+        unassigned_.pop_back();
+
+        // Best and second-best value; the miss (value 0) is always a candidate
+        uint32_t best_plot = NO_PLOT;
+        double best_value = 0.0;
+        double second_value = -std::numeric_limits<double>::infinity();
+        for (uint32_t arc = arc_start_[t]; arc < arc_start_[t + 1]; ++arc) {
+            const double value = arc_benefit_[arc] - price_[arc_plot_[arc]];
+            if (value > best_value) {
+                second_value = best_value;
+                best_value = value;
+                best_plot = arc_plot_[arc];
+            } else if (value > second_value) {
+                second_value = value;
+            }
+        }
+        if (best_plot == NO_PLOT) {
+            continue; // The miss is the best this track can do
+        }
+
+        // Bid: raise the price until the track is indifferent to its runner-up
+        price_[best_plot] += best_value - second_value + config_.auction_epsilon;
+        stats_.bids++;
+        const uint32_t previous = owner_[best_plot];
+        owner_[best_plot] = t;
+        plot_for_track[t] = best_plot;
+        if (previous != NO_OWNER) {
+            plot_for_track[previous] = NO_PLOT;
+            unassigned_.push_back(previous);
+        }
+    }
+
+    for (size_t t = 0; t < track_count; ++t) {
+        if (plot_for_track[t] != NO_PLOT) {
+            stats_.assigned++;
+        }
+    }
+}
+
+} // namespace c2
+} // namespace skyguardis
@@ -1,38 +1,38 @@
 #include "c2_controller/threat_evaluator.hpp"
-#include <algorithm>
-#include <cmath>
+#include "c2_controller/threat_policy.hpp"
 
 namespace skyguardis {
 namespace c2 {
 
+ThreatEvaluator::ThreatEvaluator() : policy_(threatPolicy(0)) {}
+
+ThreatEvaluator::ThreatEvaluator(const ThreatPolicy& policy) : policy_(&policy) {}
+
 ThreatEvaluator::ThreatScore ThreatEvaluator::evaluate(const Track& track) const {
-    ThreatScore score;
-    score.track_id = track.id;
-    score.score = computeThreatScore(track);
-    score.priority = static_cast<uint8_t>(std::min(255.0, score.score * 10.0));
-    return score;
+    return policy_->evaluate(track);
 }
 
-std::vector<ThreatEvaluator::ThreatScore> ThreatEvaluator::prioritize(
-    const std::vector<Track>& tracks) const {
+std::vector<ThreatEvaluator::ThreatScore> ThreatEvaluator::prioritize(TrackSpan tracks) const {
     std::vector<ThreatScore> scores;
-    for (const auto& track : tracks) {
-        scores.push_back(evaluate(track));
-    }
-    std::sort(scores.begin(), scores.end(),
-              [](const ThreatScore& a, const ThreatScore& b) {
-                  return a.score > b.score;
-              });
+    policy_->prioritize(tracks, scores);
     return scores;
 }
 
-double ThreatEvaluator::computeThreatScore(const Track& track) const {
-    // Simplified threat scoring: closer and faster = higher threat
-    double range_factor = 1.0 / (1.0 + track.range_m / 1000.0);
-    double velocity_factor = track.velocity_ms / 100.0;
-    return range_factor * velocity_factor;
+void ThreatEvaluator::prioritize(TrackSpan tracks, common::ArenaVector<ThreatScore>& scores) const {
+    policy_->prioritizeArena(tracks, scores);
+}
+
+void ThreatEvaluator::topK(TrackSpan tracks, size_t k, std::vector<ThreatScore>& scores) const {
+    policy_->topK(tracks, k, scores);
+}
+
+void ThreatEvaluator::topK(TrackSpan tracks, size_t k, common::ArenaVector<ThreatScore>& scores) const {
+    policy_->topKArena(tracks, k, scores);
+}
+
+void ThreatEvaluator::scoreBatch(const TrackColumns& tracks, double* scores) const {
+    policy_->scoreBatch(tracks, scores);
 }
 
 } // namespace c2
 } // namespace skyguardis
-
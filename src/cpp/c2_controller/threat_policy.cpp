@@ -0,0 +1,334 @@
+#include "c2_controller/threat_policy.hpp"
+#include "c2_controller/closest_approach.hpp"
+#include "common/kernel_isa.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+// Closest-approach scales: a 1 km miss or a minute to go halves the score
+constexpr double MISS_SCALE_M = 1000.0;
+constexpr double TIME_TO_GO_SCALE_S = 60.0;
+
+template <typename V>
+__attribute__((always_inline)) inline void loadLane(V& value, const double* column, size_t i) {
+    std::memcpy(&value, column + i, sizeof(V));
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void storeLane(double* column, size_t i, const V& value) {
+    std::memcpy(column + i, &value, sizeof(V));
+}
+
+// Simplified threat scoring: closer and faster = higher threat. V is
+// double for the per-track path or a vector of lanes for the batch
+// kernels; the operations are the same, so both round identically.
+template <typename V>
+__attribute__((always_inline)) inline void rangeSpeedScore(V& score, const V& range_m,
+                                                           const V& velocity_ms) {
+    const V range_factor = 1.0 / (1.0 + range_m / 1000.0);
+    const V velocity_factor = velocity_ms / 100.0;
+    score = range_factor * velocity_factor;
+}
+
+// Closest-approach scoring: tracks that will pass close, soon and fast
+// score highest. Speed plus closing speed runs from twice the speed head-on
+// through the speed alone when crossing down to 0 flying straight away, so
+// a head-on track weighs the same as in rangeSpeedScore and receding ones
+// drop out.
+template <typename V>
+__attribute__((always_inline)) inline void approachScore(V& score, const V& velocity_ms,
+                                                         const V& closing_speed_ms,
+                                                         const V& miss_distance_m,
+                                                         const V& time_to_go_s) {
+    const V approach_factor = (velocity_ms + closing_speed_ms) / 200.0;
+    const V miss_factor = 1.0 / (1.0 + miss_distance_m / MISS_SCALE_M);
+    const V time_factor = 1.0 / (1.0 + time_to_go_s / TIME_TO_GO_SCALE_S);
+    score = approach_factor * miss_factor * time_factor;
+}
+
+// Rows [begin, begin + count) of `tracks`
+TrackColumns columnRange(const TrackColumns& tracks, size_t begin, size_t count) {
+    TrackColumns part = {tracks.range_m + begin, tracks.azimuth_rad + begin,
+                         tracks.elevation_rad + begin, tracks.velocity_ms + begin,
+                         tracks.heading_rad + begin, count};
+    return part;
+}
+
+} // namespace
+
+// ---- Policies ----
+
+double RangeSpeedPolicy::score(const Track& track) {
+    double score;
+    rangeSpeedScore(score, track.range_m, track.velocity_ms);
+    return score;
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void RangeSpeedPolicy::scoreLanes(
+        V& score, const TrackColumns& tracks, const Block&, size_t i) {
+    V range, speed;
+    loadLane(range, tracks.range_m, i);
+    loadLane(speed, tracks.velocity_ms, i);
+    rangeSpeedScore(score, range, speed);
+}
+
+void ClosestApproachPolicy::prepare(const TrackColumns& tracks, Block& block) {
+    closestApproachBatch(tracks.range_m, tracks.azimuth_rad, tracks.elevation_rad,
+                         tracks.velocity_ms, tracks.heading_rad, block.miss_distance_m,
+                         block.time_to_go_s, block.closing_speed_ms, tracks.count);
+}
+
+double ClosestApproachPolicy::score(const Track& track) {
+    const ClosestApproach approach = closestApproach(track);
+    double score;
+    approachScore(score, track.velocity_ms, approach.closing_speed_ms,
+                  approach.miss_distance_m, approach.time_to_go_s);
+    return score;
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void ClosestApproachPolicy::scoreLanes(
+        V& score, const TrackColumns& tracks, const Block& block, size_t i) {
+    V speed, closing, miss, time_to_go;
+    loadLane(speed, tracks.velocity_ms, i);
+    loadLane(closing, block.closing_speed_ms, i);
+    loadLane(miss, block.miss_distance_m, i);
+    loadLane(time_to_go, block.time_to_go_s, i);
+    approachScore(score, speed, closing, miss, time_to_go);
+}
+
+// ---- Batch loops ----
+
+namespace {
+
+#ifdef SKYGUARDIS_X86_KERNELS
+
+typedef double Double2 __attribute__((vector_size(16)));
+typedef double Double4 __attribute__((vector_size(32)));
+
+template <typename Policy>
+__attribute__((target("avx2,fma")))
+size_t scoreAvx2(const TrackColumns& tracks, const typename Policy::Block& block, double* scores) {
+    size_t i = 0;
+    for (; i + 4 <= tracks.count; i += 4) {
+        Double4 score;
+        Policy::scoreLanes(score, tracks, block, i);
+        storeLane(scores, i, score);
+    }
+    return i;
+}
+
+template <typename Policy>
+__attribute__((target("sse4.1")))
+size_t scoreSse41(const TrackColumns& tracks, const typename Policy::Block& block, double* scores) {
+    size_t i = 0;
+    for (; i + 2 <= tracks.count; i += 2) {
+        Double2 score;
+        Policy::scoreLanes(score, tracks, block, i);
+        storeLane(scores, i, score);
+    }
+    return i;
+}
+
+#endif // SKYGUARDIS_X86_KERNELS
+
+// Score one prepared block
+template <typename Policy>
+void scoreBlock(const TrackColumns& tracks, const typename Policy::Block& block, double* scores) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = scoreAvx2<Policy>(tracks, block, scores);
+            break;
+        case common::KernelIsa::SSE41:
+            done = scoreSse41<Policy>(tracks, block, scores);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < tracks.count; ++i) {
+        Policy::scoreLanes(scores[i], tracks, block, i);
+    }
+}
+
+template <typename Policy>
+ThreatEvaluator::ThreatScore makeScore(uint32_t track_id, uint32_t track_index, double value) {
+    ThreatEvaluator::ThreatScore score;
+    score.track_id = track_id;
+    score.track_index = track_index;
+    score.score = value;
+    score.priority = Policy::priority(value);
+    return score;
+}
+
+} // namespace
+
+// ---- PolicyEvaluator ----
+
+template <typename Policy>
+typename PolicyEvaluator<Policy>::ThreatScore PolicyEvaluator<Policy>::evaluate(const Track& track) {
+    return makeScore<Policy>(track.id, ThreatEvaluator::NO_TRACK_INDEX, Policy::score(track));
+}
+
+template <typename Policy>
+void PolicyEvaluator<Policy>::scoreBatch(const TrackColumns& tracks, double* scores) {
+    typename Policy::Block block;
+    for (size_t begin = 0; begin < tracks.count; begin += THREAT_SCORE_BLOCK) {
+        const TrackColumns part =
+            columnRange(tracks, begin, std::min(THREAT_SCORE_BLOCK, tracks.count - begin));
+        Policy::prepare(part, block);
+        scoreBlock<Policy>(part, block, scores + begin);
+    }
+}
+
+template <typename Policy>
+void PolicyEvaluator<Policy>::prioritize(TrackSpan tracks, std::vector<ThreatScore>& scores) {
+    rank(tracks, scores);
+}
+
+template <typename Policy>
+void PolicyEvaluator<Policy>::prioritize(TrackSpan tracks, common::ArenaVector<ThreatScore>& scores) {
+    rank(tracks, scores);
+}
+
+template <typename Policy>
+void PolicyEvaluator<Policy>::topK(TrackSpan tracks, size_t k, std::vector<ThreatScore>& scores) {
+    selectTop(tracks, k, scores);
+}
+
+template <typename Policy>
+void PolicyEvaluator<Policy>::topK(TrackSpan tracks, size_t k,
+                                   common::ArenaVector<ThreatScore>& scores) {
+    selectTop(tracks, k, scores);
+}
+
+template <typename Policy>
+template <typename Visit>
+void PolicyEvaluator<Policy>::forEachScore(TrackSpan tracks, Visit visit) {
+    if (!Policy::BULK_RANKING) {
+        for (size_t i = 0; i < tracks.size(); ++i) {
+            visit(makeScore<Policy>(tracks[i].id, static_cast<uint32_t>(i), Policy::score(tracks[i])));
+        }
+        return;
+    }
+
+    // Gather blocks of tracks into columns and score them in bulk
+    double range_m[THREAT_SCORE_BLOCK];
+    double azimuth_rad[THREAT_SCORE_BLOCK];
+    double elevation_rad[THREAT_SCORE_BLOCK];
+    double velocity_ms[THREAT_SCORE_BLOCK];
+    double heading_rad[THREAT_SCORE_BLOCK];
+    double block_scores[THREAT_SCORE_BLOCK];
+    typename Policy::Block block;
+    for (size_t begin = 0; begin < tracks.size(); begin += THREAT_SCORE_BLOCK) {
+        const size_t count = std::min(THREAT_SCORE_BLOCK, tracks.size() - begin);
+        for (size_t i = 0; i < count; ++i) {
+            const Track& track = tracks[begin + i];
+            range_m[i] = track.range_m;
+            azimuth_rad[i] = track.azimuth_rad;
+            elevation_rad[i] = track.elevation_rad;
+            velocity_ms[i] = track.velocity_ms;
+            heading_rad[i] = track.heading_rad;
+        }
+        const TrackColumns columns = {range_m, azimuth_rad, elevation_rad, velocity_ms,
+                                      heading_rad, count};
+        Policy::prepare(columns, block);
+        scoreBlock<Policy>(columns, block, block_scores);
+        for (size_t i = 0; i < count; ++i) {
+            visit(makeScore<Policy>(tracks[begin + i].id, static_cast<uint32_t>(begin + i),
+                                    block_scores[i]));
+        }
+    }
+}
+
+template <typename Policy>
+template <typename Scores>
+void PolicyEvaluator<Policy>::rank(TrackSpan tracks, Scores& scores) {
+    scores.clear();
+    scores.reserve(tracks.size());
+    forEachScore(tracks, [&](const ThreatScore& score) {
+        scores.push_back(score);
+    });
+    std::sort(scores.begin(), scores.end(), ThreatEvaluator::ranksHigher);
+}
+
+template <typename Policy>
+template <typename Scores>
+void PolicyEvaluator<Policy>::selectTop(TrackSpan tracks, size_t k, Scores& scores) {
+    scores.clear();
+    k = std::min(k, tracks.size());
+    if (k == 0) {
+        return;
+    }
+    scores.reserve(k);
+
+    // Heap ordered by ranksHigher keeps the weakest of the k best at the
+    // front, so most tracks are rejected by a single comparison
+    forEachScore(tracks, [&](const ThreatScore& score) {
+        if (scores.size() < k) {
+            scores.push_back(score);
+            std::push_heap(scores.begin(), scores.end(), ThreatEvaluator::ranksHigher);
+        } else if (ThreatEvaluator::ranksHigher(score, scores.front())) {
+            std::pop_heap(scores.begin(), scores.end(), ThreatEvaluator::ranksHigher);
+            scores.back() = score;
+            std::push_heap(scores.begin(), scores.end(), ThreatEvaluator::ranksHigher);
+        }
+    });
+    std::sort_heap(scores.begin(), scores.end(), ThreatEvaluator::ranksHigher);
+}
+
+template class PolicyEvaluator<RangeSpeedPolicy>;
+template class PolicyEvaluator<ClosestApproachPolicy>;
+
+// ---- Registry ----
+
+namespace {
+
+template <typename Policy>
+constexpr ThreatPolicy registryRow() {
+    return ThreatPolicy{Policy::NAME,
+                        Policy::DESCRIPTION,
+                        &PolicyEvaluator<Policy>::evaluate,
+                        &PolicyEvaluator<Policy>::scoreBatch,
+                        &PolicyEvaluator<Policy>::prioritize,
+                        &PolicyEvaluator<Policy>::prioritize,
+                        &PolicyEvaluator<Policy>::topK,
+                        &PolicyEvaluator<Policy>::topK};
+}
+
+constexpr ThreatPolicy THREAT_POLICIES[] = {
+    registryRow<RangeSpeedPolicy>(),
+    registryRow<ClosestApproachPolicy>(),
+};
+
+constexpr size_t THREAT_POLICY_COUNT = sizeof(THREAT_POLICIES) / sizeof(THREAT_POLICIES[0]);
+
+} // namespace
+
+size_t threatPolicyCount() {
+    return THREAT_POLICY_COUNT;
+}
+
+const ThreatPolicy* threatPolicy(size_t index) {
+    return index < THREAT_POLICY_COUNT ? &THREAT_POLICIES[index] : nullptr;
+}
+
+const ThreatPolicy* findThreatPolicy(const char* name) {
+    for (const ThreatPolicy& policy : THREAT_POLICIES) {
+        if (std::strcmp(policy.name, name) == 0) {
+            return &policy;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace c2
+} // namespace skyguardis
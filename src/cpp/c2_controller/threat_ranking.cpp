@@ -0,0 +1,221 @@
+#include "c2_controller/threat_ranking.hpp"
+#include <algorithm>
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+bool sameState(const Track& a, const Track& b) {
+    return a.range_m == b.range_m && a.azimuth_rad == b.azimuth_rad &&
+           a.elevation_rad == b.elevation_rad && a.velocity_ms == b.velocity_ms &&
+           a.heading_rad == b.heading_rad;
+}
+
+} // namespace
+
+ThreatRanking::ThreatRanking(const ThreatEvaluator& evaluator)
+    : evaluator_(evaluator), sync_count_(0) {}
+
+void ThreatRanking::update(const Track& track) {
+    auto it = index_.find(track.id);
+    if (it == index_.end()) {
+        insert(track);
+    } else {
+        rescore(it->second, track);
+    }
+}
+
+bool ThreatRanking::remove(uint32_t track_id) {
+    auto it = index_.find(track_id);
+    if (it == index_.end()) {
+        return false;
+    }
+    erase(it->second);
+    return true;
+}
+
+void ThreatRanking::sync(TrackSpan tracks) {
+    stats_ = RankingStats();
+    const uint32_t stamp = ++sync_count_;
+
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        const Track& track = tracks[i];
+        auto it = index_.find(track.id);
+        uint32_t entry = 0;
+        if (it == index_.end()) {
+            entry = static_cast<uint32_t>(entries_.size());
+            insert(track);
+            stats_.inserted++;
+        } else {
+            entry = it->second;
+            if (sameState(entries_[entry].track, track)) {
+                stats_.unchanged++;
+            } else {
+                rescore(entry, track);
+                stats_.rescored++;
+            }
+        }
+        entries_[entry].seen_sync = stamp;
+        entries_[entry].score.track_index = static_cast<uint32_t>(i);
+    }
+
+    // Departures: only scan when some known track was not reported
+    if (entries_.size() > tracks.size()) {
+        for (size_t e = entries_.size(); e-- > 0;) {
+            if (entries_[e].seen_sync != stamp) {
+                erase(static_cast<uint32_t>(e));
+                stats_.removed++;
+            }
+        }
+    }
+}
+
+void ThreatRanking::clear() {
+    entries_.clear();
+    heap_.clear();
+    index_.clear();
+}
+
+bool ThreatRanking::top(ThreatScore& best) const {
+    if (heap_.empty()) {
+        return false;
+    }
+    best = entries_[heap_[0]].score;
+    return true;
+}
+
+void ThreatRanking::topK(size_t k, std::vector<ThreatScore>& scores) const {
+    scores.clear();
+    k = std::min(k, heap_.size());
+    if (k == 0) {
+        return;
+    }
+    scores.reserve(k);
+
+    // Best-first walk of the heap: the next best is always the root of a
+    // subtree hanging off what was already taken, so only O(k) candidates
+    // are ever considered
+    auto worse = [this](uint32_t a, uint32_t b) { return ranksAbove(b, a); };
+    frontier_.clear();
+    frontier_.push_back(0);
+    while (scores.size() < k) {
+        std::pop_heap(frontier_.begin(), frontier_.end(), worse);
+        const uint32_t position = frontier_.back();
+        frontier_.pop_back();
+        scores.push_back(entries_[heap_[position]].score);
+
+        for (uint32_t child = 2 * position + 1; child <= 2 * position + 2; ++child) {
+            if (child < heap_.size()) {
+                frontier_.push_back(child);
+                std::push_heap(frontier_.begin(), frontier_.end(), worse);
+            }
+        }
+    }
+}
+
+bool ThreatRanking::find(uint32_t track_id, ThreatScore& score) const {
+    auto it = index_.find(track_id);
+    if (it == index_.end()) {
+        return false;
+    }
+    score = entries_[it->second].score;
+    return true;
+}
+
+bool ThreatRanking::ranksAbove(uint32_t heap_a, uint32_t heap_b) const {
+    return ThreatEvaluator::ranksHigher(entries_[heap_[heap_a]].score, entries_[heap_[heap_b]].score);
+}
+
+void ThreatRanking::place(uint32_t heap_position, uint32_t entry) {
+    heap_[heap_position] = entry;
+    entries_[entry].heap_position = heap_position;
+}
+
+void ThreatRanking::siftUp(uint32_t heap_position) {
+    const uint32_t entry = heap_[heap_position];
+    const ThreatScore& score = entries_[entry].score;
+    while (heap_position > 0) {
+        const uint32_t parent = (heap_position - 1) / 2;
+        if (!ThreatEvaluator::ranksHigher(score, entries_[heap_[parent]].score)) {
+            break;
+        }
+        place(heap_position, heap_[parent]);
+        heap_position = parent;
+    }
+    place(heap_position, entry);
+}
+
+void ThreatRanking::siftDown(uint32_t heap_position) {
+    const uint32_t entry = heap_[heap_position];
+    const ThreatScore& score = entries_[entry].score;
+    const uint32_t count = static_cast<uint32_t>(heap_.size());
+    for (;;) {
+        uint32_t child = 2 * heap_position + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && ranksAbove(child + 1, child)) {
+            ++child;
+        }
+        if (!ThreatEvaluator::ranksHigher(entries_[heap_[child]].score, score)) {
+            break;
+        }
+        place(heap_position, heap_[child]);
+        heap_position = child;
+    }
+    place(heap_position, entry);
+}
+
+void ThreatRanking::restore(uint32_t heap_position) {
+    if (heap_position > 0 && ranksAbove(heap_position, (heap_position - 1) / 2)) {
+        siftUp(heap_position);
+    } else {
+        siftDown(heap_position);
+    }
+}
+
+void ThreatRanking::insert(const Track& track) {
+    const uint32_t entry = static_cast<uint32_t>(entries_.size());
+    Entry added;
+    added.track = track;
+    added.score = evaluator_.evaluate(track);
+    added.heap_position = static_cast<uint32_t>(heap_.size());
+    added.seen_sync = 0;
+    entries_.push_back(added);
+    heap_.push_back(entry);
+    index_[track.id] = entry;
+    siftUp(added.heap_position);
+}
+
+void ThreatRanking::rescore(uint32_t entry, const Track& track) {
+    Entry& changed = entries_[entry];
+    changed.track = track;
+    changed.score = evaluator_.evaluate(track);
+    restore(changed.heap_position);
+}
+
+void ThreatRanking::erase(uint32_t entry) {
+    index_.erase(entries_[entry].track.id);
+
+    // The last heap leaf fills the hole, then moves whichever way it must
+    const uint32_t hole = entries_[entry].heap_position;
+    const uint32_t last = heap_.back();
+    heap_.pop_back();
+    if (hole < heap_.size()) {
+        place(hole, last);
+        restore(hole);
+    }
+
+    // The last entry takes over the freed slot
+    const uint32_t moved = static_cast<uint32_t>(entries_.size() - 1);
+    if (entry != moved) {
+        entries_[entry] = entries_[moved];
+        heap_[entries_[entry].heap_position] = entry;
+        index_[entries_[entry].track.id] = entry;
+    }
+    entries_.pop_back();
+}
+
+} // namespace c2
+} // namespace skyguardis
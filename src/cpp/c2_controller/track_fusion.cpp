@@ -0,0 +1,202 @@
+#include "c2_controller/track_fusion.hpp"
+#include "common/enu_frame.hpp"
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+constexpr size_t SYM[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+
+void loadMatrix(const PositionSet& set, size_t index, double (&matrix)[3][3]) {
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            matrix[r][c] = set.covariance[SYM[r][c]][index];
+        }
+    }
+}
+
+// Inverse of a symmetric 3x3 matrix by cofactors; false when singular
+bool invert(const double (&s)[3][3], double (&inverse)[3][3]) {
+    const double c00 = s[1][1] * s[2][2] - s[1][2] * s[1][2];
+    const double c01 = s[0][2] * s[1][2] - s[0][1] * s[2][2];
+    const double c02 = s[0][1] * s[1][2] - s[0][2] * s[1][1];
+    const double c11 = s[0][0] * s[2][2] - s[0][2] * s[0][2];
+    const double c12 = s[0][1] * s[0][2] - s[0][0] * s[1][2];
+    const double c22 = s[0][0] * s[1][1] - s[0][1] * s[0][1];
+    const double det = s[0][0] * c00 + s[0][1] * c01 + s[0][2] * c02;
+    if (det <= 0.0) {
+        return false;
+    }
+    const double scale = 1.0 / det;
+    inverse[0][0] = c00 * scale;
+    inverse[0][1] = inverse[1][0] = c01 * scale;
+    inverse[0][2] = inverse[2][0] = c02 * scale;
+    inverse[1][1] = c11 * scale;
+    inverse[1][2] = inverse[2][1] = c12 * scale;
+    inverse[2][2] = c22 * scale;
+    return true;
+}
+
+// Default track-to-track gate, wider than the plot gate: a local filter
+// lagging a maneuver is overconfident, and its duplicate would otherwise
+// survive the merge
+AssociatorConfig defaultFusionGate() {
+    AssociatorConfig config;
+    config.gate_chi2 = 50.0;
+    return config;
+}
+
+} // namespace
+
+TrackFusion::TrackFusion() : associator_(defaultFusionGate()) {}
+
+TrackFusion::TrackFusion(const AssociatorConfig& association) : associator_(association) {}
+
+uint32_t TrackFusion::addSensor(const SensorSite& site, const TrackerConfig& config) {
+    Sensor sensor;
+    sensor.site = site;
+    sensor.bank.setConfig(config);
+    sensors_.push_back(sensor);
+    return static_cast<uint32_t>(sensors_.size() - 1);
+}
+
+void TrackFusion::clear() {
+    for (auto& sensor : sensors_) {
+        sensor.bank.clear();
+    }
+    fused_.resize(0);
+    tracks_.clear();
+    stats_ = FusionStats();
+}
+
+void TrackFusion::processReport(uint32_t sensor, const std::vector<Measurement>& plots,
+                                double time_s) {
+    if (sensor < sensors_.size()) {
+        sensors_[sensor].bank.processScan(plots, time_s);
+    }
+}
+
+void TrackFusion::fuse(double time_s) {
+    stats_ = FusionStats();
+    stats_.sensors = sensors_.size();
+    fused_.resize(0);
+
+    for (uint32_t s = 0; s < sensors_.size(); ++s) {
+        // Local picture at the fusion time, in the fusion frame
+        const Sensor& sensor = sensors_[s];
+        sensor.bank.extrapolate(time_s, local_);
+        for (size_t i = 0; i < local_.size(); ++i) {
+            local_.position.east_m[i] += sensor.site.east_m;
+            local_.position.north_m[i] += sensor.site.north_m;
+            local_.position.up_m[i] += sensor.site.up_m;
+        }
+        stats_.local_tracks += local_.size();
+
+        // Pair with the picture so far; the rest are new to the picture
+        local_used_.assign(local_.size(), 0);
+        if (fused_.size() > 0) {
+            associator_.associate(fused_.position, local_.position, local_for_fused_);
+            for (size_t f = 0; f < local_for_fused_.size(); ++f) {
+                const uint32_t l = local_for_fused_[f];
+                if (l != NO_PLOT) {
+                    merge(f, l);
+                    local_used_[l] = 1;
+                    stats_.merged++;
+                }
+            }
+        }
+        for (size_t l = 0; l < local_.size(); ++l) {
+            if (!local_used_[l]) {
+                append(l, s);
+            }
+        }
+    }
+    stats_.fused_tracks = fused_.size();
+
+    tracks_.resize(fused_.size());
+    for (size_t i = 0; i < fused_.size(); ++i) {
+        common::EnuState enu;
+        enu.east_m = fused_.position.east_m[i];
+        enu.north_m = fused_.position.north_m[i];
+        enu.up_m = fused_.position.up_m[i];
+        enu.vel_east_ms = fused_.vel_east_ms[i];
+        enu.vel_north_ms = fused_.vel_north_ms[i];
+        enu.vel_up_ms = fused_.vel_up_ms[i];
+        common::toSpherical(enu, tracks_[i]);
+        tracks_[i].id = fused_.id[i];
+    }
+}
+
+void TrackFusion::merge(size_t fused, size_t local) {
+    // Position: K = A (A + B)^-1,  x = a + K (b - a),  P = A - K A
+    double a[3][3], b[3][3], sum[3][3], sum_inverse[3][3];
+    loadMatrix(fused_.position, fused, a);
+    loadMatrix(local_.position, local, b);
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            sum[r][c] = a[r][c] + b[r][c];
+        }
+    }
+    if (!invert(sum, sum_inverse)) {
+        return; // Degenerate covariances: keep the fused estimate
+    }
+    double gain[3][3];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            gain[r][c] = a[r][0] * sum_inverse[0][c] + a[r][1] * sum_inverse[1][c] +
+                         a[r][2] * sum_inverse[2][c];
+        }
+    }
+    const double difference[3] = {
+        local_.position.east_m[local] - fused_.position.east_m[fused],
+        local_.position.north_m[local] - fused_.position.north_m[fused],
+        local_.position.up_m[local] - fused_.position.up_m[fused]};
+    double position[3] = {fused_.position.east_m[fused], fused_.position.north_m[fused],
+                          fused_.position.up_m[fused]};
+    double matrix[3][3];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t k = 0; k < 3; ++k) {
+            position[r] += gain[r][k] * difference[k];
+        }
+        for (size_t c = 0; c < 3; ++c) {
+            matrix[r][c] = a[r][c] - (gain[r][0] * a[0][c] + gain[r][1] * a[1][c] +
+                                      gain[r][2] * a[2][c]);
+        }
+    }
+    // Symmetrise against rounding
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = r + 1; c < 3; ++c) {
+            matrix[r][c] = matrix[c][r] = 0.5 * (matrix[r][c] + matrix[c][r]);
+        }
+    }
+    fused_.position.set(fused, position, matrix);
+
+    // Velocity: scalar variance weighting
+    const double va = fused_.velocity_variance[fused];
+    const double vb = local_.velocity_variance[local];
+    const double weight = va / (va + vb);
+    fused_.vel_east_ms[fused] += weight * (local_.vel_east_ms[local] - fused_.vel_east_ms[fused]);
+    fused_.vel_north_ms[fused] += weight * (local_.vel_north_ms[local] - fused_.vel_north_ms[fused]);
+    fused_.vel_up_ms[fused] += weight * (local_.vel_up_ms[local] - fused_.vel_up_ms[fused]);
+    fused_.velocity_variance[fused] = va * vb / (va + vb);
+}
+
+void TrackFusion::append(size_t local, uint32_t sensor) {
+    const size_t index = fused_.size();
+    fused_.resize(index + 1);
+    fused_.id[index] = local_.id[local] | (sensor << FUSED_SENSOR_SHIFT);
+    for (size_t k = 0; k < 6; ++k) {
+        fused_.position.covariance[k][index] = local_.position.covariance[k][local];
+    }
+    fused_.position.east_m[index] = local_.position.east_m[local];
+    fused_.position.north_m[index] = local_.position.north_m[local];
+    fused_.position.up_m[index] = local_.position.up_m[local];
+    fused_.vel_east_ms[index] = local_.vel_east_ms[local];
+    fused_.vel_north_ms[index] = local_.vel_north_ms[local];
+    fused_.vel_up_ms[index] = local_.vel_up_ms[local];
+    fused_.velocity_variance[index] = local_.velocity_variance[local];
+}
+
+} // namespace c2
+} // namespace skyguardis
@@ -0,0 +1,765 @@
+#include "c2_controller/tracker_bank.hpp"
+#include "common/enu_frame.hpp"
+#include "common/kernel_isa.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace skyguardis {
+namespace c2 {
+
+namespace {
+
+// Column layout of the covariance: upper triangle of the 6x6 matrix split
+// into the position block (PP, symmetric), the position/velocity block
+// (PV, row = position axis, column = velocity axis) and the velocity
+// block (VV, symmetric).
+constexpr size_t PP = 0;
+constexpr size_t PV = 6;
+constexpr size_t VV = 15;
+constexpr size_t SYM[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+
+// Turn coefficients: position gain (A) and velocity rotation (B) columns
+constexpr size_t A_COS = 0;   // sin(w dt) / w
+constexpr size_t A_SIN = 1;   // (1 - cos(w dt)) / w
+constexpr size_t B_COS = 2;   // cos(w dt)
+constexpr size_t B_SIN = 3;   // sin(w dt)
+
+// Plot columns: converted position, its covariance, and the update weight
+// (1 for filters with a plot this scan, 0 for coasting filters)
+constexpr size_t PLOT_POSITION = 0;
+constexpr size_t PLOT_COVARIANCE = 3;
+constexpr size_t PLOT_WEIGHT = 9;
+
+constexpr double MIN_TURN_SPEED_MS = 10.0;  // Slower filters keep their turn rate
+constexpr double SMALL_TURN_RAD = 1e-6;     // Below this the series form is exact
+
+// White acceleration noise integrated over one scan
+struct ProcessNoise {
+    double position;   // q dt^3 / 3
+    double cross;      // q dt^2 / 2
+    double velocity;   // q dt
+};
+
+template <typename V>
+__attribute__((always_inline)) inline void loadLane(V& value, const double* column, size_t i) {
+    std::memcpy(&value, column + i, sizeof(V));
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void storeLane(double* column, size_t i, const V& value) {
+    std::memcpy(column + i, &value, sizeof(V));
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void loadSym(V (&m)[3][3], double* const* columns,
+                                                   size_t first, size_t i) {
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = r; c < 3; ++c) {
+            loadLane(m[r][c], columns[first + SYM[r][c]], i);
+            m[c][r] = m[r][c];
+        }
+    }
+}
+
+// Predict sizeof(V) / sizeof(double) filters starting at row i:
+//   x' = F x,  P' = F P F^T + Q,  F = [I A; 0 B]
+// A integrates the (turning) velocity into position, B turns it.
+template <typename V>
+__attribute__((always_inline)) inline void predictLanes(double* const* state,
+                                                        double* const* covariance,
+                                                        double* const* transition,
+                                                        size_t i, double delta_time_s,
+                                                        const ProcessNoise& noise) {
+    const V zero = V();
+    V a_cos, a_sin, b_cos, b_sin;
+    loadLane(a_cos, transition[A_COS], i);
+    loadLane(a_sin, transition[A_SIN], i);
+    loadLane(b_cos, transition[B_COS], i);
+    loadLane(b_sin, transition[B_SIN], i);
+    const V a[3][3] = {{a_cos, a_sin, zero}, {zero - a_sin, a_cos, zero},
+                       {zero, zero, zero + delta_time_s}};
+    const V b[3][3] = {{b_cos, b_sin, zero}, {zero - b_sin, b_cos, zero},
+                       {zero, zero, zero + 1.0}};
+
+    V x[6];
+    for (size_t k = 0; k < 6; ++k) {
+        loadLane(x[k], state[k], i);
+    }
+    V pp[3][3], pv[3][3], vv[3][3];
+    loadSym(pp, covariance, PP, i);
+    loadSym(vv, covariance, VV, i);
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            loadLane(pv[r][c], covariance[PV + 3 * r + c], i);
+        }
+    }
+
+    // State
+    for (size_t r = 0; r < 3; ++r) {
+        V position = x[r];
+        V velocity = zero;
+        for (size_t k = 0; k < 3; ++k) {
+            position += a[r][k] * x[3 + k];
+            velocity += b[r][k] * x[3 + k];
+        }
+        storeLane(state[r], i, position);
+        storeLane(state[3 + r], i, velocity);
+    }
+
+    // M = PV + A VV, then PP' = PP + A PV^T + M A^T, PV' = M B^T, VV' = B VV B^T
+    V m[3][3], bv[3][3];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            V sum_m = pv[r][c];
+            V sum_bv = zero;
+            for (size_t k = 0; k < 3; ++k) {
+                sum_m += a[r][k] * vv[k][c];
+                sum_bv += b[r][k] * vv[k][c];
+            }
+            m[r][c] = sum_m;
+            bv[r][c] = sum_bv;
+        }
+    }
+    const V q_position = zero + noise.position;
+    const V q_cross = zero + noise.cross;
+    const V q_velocity = zero + noise.velocity;
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            V sum_pv = zero;
+            for (size_t k = 0; k < 3; ++k) {
+                sum_pv += m[r][k] * b[c][k];
+            }
+            if (r == c) {
+                sum_pv += q_cross;
+            }
+            storeLane(covariance[PV + 3 * r + c], i, sum_pv);
+        }
+        for (size_t c = r; c < 3; ++c) {
+            V sum_pp = pp[r][c];
+            V sum_vv = zero;
+            for (size_t k = 0; k < 3; ++k) {
+                sum_pp += a[r][k] * pv[c][k] + m[r][k] * a[c][k];
+                sum_vv += bv[r][k] * b[c][k];
+            }
+            if (r == c) {
+                sum_pp += q_position;
+                sum_vv += q_velocity;
+            }
+            storeLane(covariance[PP + SYM[r][c]], i, sum_pp);
+            storeLane(covariance[VV + SYM[r][c]], i, sum_vv);
+        }
+    }
+}
+
+// Update sizeof(V) / sizeof(double) filters starting at row i with their
+// position plots. H = [I 0], so with S = PP + R:
+//   K = [PP; PV^T] S^-1,  x += w K (z - p),  P -= w K [PP PV]
+// Weight w is 0 for coasting filters, which leaves them unchanged.
+template <typename V>
+__attribute__((always_inline)) inline void updateLanes(double* const* state,
+                                                       double* const* covariance,
+                                                       double* const* plot, size_t i) {
+    const V zero = V();
+    V x[6];
+    for (size_t k = 0; k < 6; ++k) {
+        loadLane(x[k], state[k], i);
+    }
+    V pp[3][3], pv[3][3], vv[3][3], r_plot[3][3];
+    loadSym(pp, covariance, PP, i);
+    loadSym(vv, covariance, VV, i);
+    loadSym(r_plot, plot, PLOT_COVARIANCE, i);
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            loadLane(pv[r][c], covariance[PV + 3 * r + c], i);
+        }
+    }
+    V weight;
+    loadLane(weight, plot[PLOT_WEIGHT], i);
+
+    // S^-1 by cofactors (S is symmetric positive definite)
+    V s[3][3];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            s[r][c] = pp[r][c] + r_plot[r][c];
+        }
+    }
+    const V c00 = s[1][1] * s[2][2] - s[1][2] * s[1][2];
+    const V c01 = s[0][2] * s[1][2] - s[0][1] * s[2][2];
+    const V c02 = s[0][1] * s[1][2] - s[0][2] * s[1][1];
+    const V c11 = s[0][0] * s[2][2] - s[0][2] * s[0][2];
+    const V c12 = s[0][1] * s[0][2] - s[0][0] * s[1][2];
+    const V c22 = s[0][0] * s[1][1] - s[0][1] * s[0][1];
+    const V inverse_det = (zero + 1.0) / (s[0][0] * c00 + s[0][1] * c01 + s[0][2] * c02);
+    const V s_inv[3][3] = {{c00 * inverse_det, c01 * inverse_det, c02 * inverse_det},
+                           {c01 * inverse_det, c11 * inverse_det, c12 * inverse_det},
+                           {c02 * inverse_det, c12 * inverse_det, c22 * inverse_det}};
+
+    // Weighted gains
+    V kp[3][3], kv[3][3];
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            V sum_p = zero;
+            V sum_v = zero;
+            for (size_t k = 0; k < 3; ++k) {
+                sum_p += pp[r][k] * s_inv[k][c];
+                sum_v += pv[k][r] * s_inv[k][c];
+            }
+            kp[r][c] = weight * sum_p;
+            kv[r][c] = weight * sum_v;
+        }
+    }
+
+    // State
+    V innovation[3];
+    for (size_t k = 0; k < 3; ++k) {
+        V z;
+        loadLane(z, plot[PLOT_POSITION + k], i);
+        innovation[k] = z - x[k];
+    }
+    for (size_t r = 0; r < 3; ++r) {
+        V position = x[r];
+        V velocity = x[3 + r];
+        for (size_t k = 0; k < 3; ++k) {
+            position += kp[r][k] * innovation[k];
+            velocity += kv[r][k] * innovation[k];
+        }
+        storeLane(state[r], i, position);
+        storeLane(state[3 + r], i, velocity);
+    }
+
+    // Covariance
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            V sum_pv = pv[r][c];
+            for (size_t k = 0; k < 3; ++k) {
+                sum_pv -= kp[r][k] * pv[k][c];
+            }
+            storeLane(covariance[PV + 3 * r + c], i, sum_pv);
+        }
+        for (size_t c = r; c < 3; ++c) {
+            V sum_pp = pp[r][c];
+            V sum_vv = vv[r][c];
+            for (size_t k = 0; k < 3; ++k) {
+                sum_pp -= kp[r][k] * pp[k][c];
+                sum_vv -= kv[r][k] * pv[k][c];
+            }
+            storeLane(covariance[PP + SYM[r][c]], i, sum_pp);
+            storeLane(covariance[VV + SYM[r][c]], i, sum_vv);
+        }
+    }
+}
+
+#ifdef SKYGUARDIS_X86_KERNELS
+
+typedef double Double2 __attribute__((vector_size(16)));
+typedef double Double4 __attribute__((vector_size(32)));
+
+// ---- AVX2: 4 filters per iteration ----
+
+__attribute__((target("avx2,fma")))
+size_t predictAvx2(double* const* state, double* const* covariance, double* const* transition,
+                   size_t count, double delta_time_s, const ProcessNoise& noise) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        predictLanes<Double4>(state, covariance, transition, i, delta_time_s, noise);
+    }
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+size_t updateAvx2(double* const* state, double* const* covariance, double* const* plot,
+                  size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        updateLanes<Double4>(state, covariance, plot, i);
+    }
+    return i;
+}
+
+// ---- SSE: 2 filters per iteration ----
+
+__attribute__((target("sse4.1")))
+size_t predictSse41(double* const* state, double* const* covariance, double* const* transition,
+                    size_t count, double delta_time_s, const ProcessNoise& noise) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        predictLanes<Double2>(state, covariance, transition, i, delta_time_s, noise);
+    }
+    return i;
+}
+
+__attribute__((target("sse4.1")))
+size_t updateSse41(double* const* state, double* const* covariance, double* const* plot,
+                   size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        updateLanes<Double2>(state, covariance, plot, i);
+    }
+    return i;
+}
+
+#endif // SKYGUARDIS_X86_KERNELS
+
+void predictBatch(double* const* state, double* const* covariance, double* const* transition,
+                  size_t count, double delta_time_s, const ProcessNoise& noise) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = predictAvx2(state, covariance, transition, count, delta_time_s, noise);
+            break;
+        case common::KernelIsa::SSE41:
+            done = predictSse41(state, covariance, transition, count, delta_time_s, noise);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < count; ++i) {
+        predictLanes<double>(state, covariance, transition, i, delta_time_s, noise);
+    }
+}
+
+void updateBatch(double* const* state, double* const* covariance, double* const* plot,
+                 size_t count) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = updateAvx2(state, covariance, plot, count);
+            break;
+        case common::KernelIsa::SSE41:
+            done = updateSse41(state, covariance, plot, count);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < count; ++i) {
+        updateLanes<double>(state, covariance, plot, i);
+    }
+}
+
+// Spherical plot to ENU position and covariance J diag(sr^2, sa^2, se^2) J^T
+void convertPlot(const Measurement& plot, const TrackerConfig& config,
+                 double (&position)[3], double (&covariance)[3][3]) {
+    const double sin_az = std::sin(plot.azimuth_rad);
+    const double cos_az = std::cos(plot.azimuth_rad);
+    const double sin_el = std::sin(plot.elevation_rad);
+    const double cos_el = std::cos(plot.elevation_rad);
+    const double r = plot.range_m;
+    position[0] = r * cos_el * sin_az;
+    position[1] = r * cos_el * cos_az;
+    position[2] = r * sin_el;
+
+    // Columns of J scaled by the sigmas: d/drange, d/dazimuth, d/delevation
+    const double j[3][3] = {
+        {cos_el * sin_az * config.range_sigma_m, r * cos_el * cos_az * config.azimuth_sigma_rad,
+         -r * sin_el * sin_az * config.elevation_sigma_rad},
+        {cos_el * cos_az * config.range_sigma_m, -r * cos_el * sin_az * config.azimuth_sigma_rad,
+         -r * sin_el * cos_az * config.elevation_sigma_rad},
+        {sin_el * config.range_sigma_m, 0.0, r * cos_el * config.elevation_sigma_rad}};
+    for (size_t row = 0; row < 3; ++row) {
+        for (size_t col = 0; col < 3; ++col) {
+            covariance[row][col] = j[row][0] * j[col][0] + j[row][1] * j[col][1] +
+                                   j[row][2] * j[col][2];
+        }
+    }
+}
+
+template <typename T>
+void swapPop(std::vector<T>& column, size_t index) {
+    if (index + 1 != column.size()) {
+        column[index] = column.back();
+    }
+    column.pop_back();
+}
+
+} // namespace
+
+void TrackEstimates::resize(size_t count) {
+    id.resize(count);
+    position.resize(count);
+    vel_east_ms.resize(count);
+    vel_north_ms.resize(count);
+    vel_up_ms.resize(count);
+    velocity_variance.resize(count);
+}
+
+TrackerBank::TrackerBank() : time_s_(0.0), started_(false), next_track_id_(1) {}
+
+TrackerBank::TrackerBank(const TrackerConfig& config)
+    : config_(config), associator_(config.association), time_s_(0.0), started_(false),
+      next_track_id_(1) {}
+
+void TrackerBank::setConfig(const TrackerConfig& config) {
+    config_ = config;
+    associator_.setConfig(config.association);
+}
+
+void TrackerBank::clear() {
+    id_.clear();
+    for (auto& column : state_) column.clear();
+    for (auto& column : covariance_) column.clear();
+    for (auto& column : transition_) column.clear();
+    for (auto& column : plot_) column.clear();
+    turn_rate_rads_.clear();
+    last_vel_east_ms_.clear();
+    last_vel_north_ms_.clear();
+    last_plot_time_s_.clear();
+    plot_count_.clear();
+    missed_scans_.clear();
+    id_row_.clear();
+    tracks_.clear();
+    time_s_ = 0.0;
+    started_ = false;
+    next_track_id_ = 1;
+}
+
+void TrackerBank::processScan(const std::vector<Measurement>& plots, double time_s) {
+    const double delta_time_s = started_ ? std::max(0.0, time_s - time_s_) : 0.0;
+    time_s_ = time_s;
+    started_ = true;
+
+    double* state[STATE_TERMS];
+    double* covariance[COVARIANCE_TERMS];
+    double* transition[TRANSITION_TERMS];
+    double* plot[PLOT_TERMS];
+
+    // Predict every existing filter to the scan time
+    size_t predicted = id_.size();
+    if (predicted > 0 && delta_time_s > 0.0) {
+        prepareTransition(delta_time_s);
+        const double q = config_.acceleration_noise;
+        ProcessNoise noise;
+        noise.position = q * delta_time_s * delta_time_s * delta_time_s / 3.0;
+        noise.cross = q * delta_time_s * delta_time_s / 2.0;
+        noise.velocity = q * delta_time_s;
+        for (size_t k = 0; k < STATE_TERMS; ++k) state[k] = state_[k].data();
+        for (size_t k = 0; k < COVARIANCE_TERMS; ++k) covariance[k] = covariance_[k].data();
+        for (size_t k = 0; k < TRANSITION_TERMS; ++k) transition[k] = transition_[k].data();
+        predictBatch(state, covariance, transition, predicted, delta_time_s, noise);
+    }
+
+    // Route plots into the plot columns of existing filters; plots that
+    // belong to no filter start new ones
+    std::fill(plot_[PLOT_WEIGHT].begin(), plot_[PLOT_WEIGHT].end(), 0.0);
+    if (config_.routing == PlotRouting::TRACK_ID) {
+        routeById(plots, time_s);
+    } else {
+        routeByAssociation(plots, time_s);
+    }
+
+    // Update the filters that were predicted (new ones already hold their plot)
+    if (predicted > 0) {
+        for (size_t k = 0; k < STATE_TERMS; ++k) state[k] = state_[k].data();
+        for (size_t k = 0; k < COVARIANCE_TERMS; ++k) covariance[k] = covariance_[k].data();
+        for (size_t k = 0; k < PLOT_TERMS; ++k) plot[k] = plot_[k].data();
+        updateBatch(state, covariance, plot, predicted);
+    }
+    estimateTurnRates(time_s);
+
+    // Drop filters that have coasted too long, and tentative filters on
+    // their first miss (new filters come after `predicted` and always have
+    // a plot)
+    for (size_t row = predicted; row-- > 0;) {
+        if (plot_[PLOT_WEIGHT][row] != 0.0) {
+            missed_scans_[row] = 0;
+        } else if (++missed_scans_[row] > (isConfirmed(row) ? config_.max_coast_scans : 0)) {
+            removeFilter(row);
+        }
+    }
+
+    // Smoothed picture of the confirmed filters
+    tracks_.clear();
+    for (size_t row = 0; row < id_.size(); ++row) {
+        if (isConfirmed(row)) {
+            tracks_.push_back(rowTrack(row));
+        }
+    }
+}
+
+void TrackerBank::routeById(const std::vector<Measurement>& plots, double time_s) {
+    double position[3];
+    double position_covariance[3][3];
+    for (const auto& measurement : plots) {
+        if (measurement.track_id == FALSE_ALARM_ID) {
+            continue; // No track to route it to
+        }
+        convertPlot(measurement, config_, position, position_covariance);
+        auto found = id_row_.find(measurement.track_id);
+        if (found == id_row_.end()) {
+            addFilter(measurement.track_id, position, position_covariance, time_s);
+        } else {
+            setPlot(found->second, position, position_covariance);
+        }
+    }
+}
+
+void TrackerBank::routeByAssociation(const std::vector<Measurement>& plots, double time_s) {
+    // Plots and predicted filter positions in ENU
+    double position[3];
+    double position_covariance[3][3];
+    scan_plots_.resize(plots.size());
+    for (size_t p = 0; p < plots.size(); ++p) {
+        convertPlot(plots[p], config_, position, position_covariance);
+        scan_plots_.set(p, position, position_covariance);
+    }
+    const size_t filters = id_.size();
+    predicted_.resize(filters);
+    std::copy(state_[0].begin(), state_[0].end(), predicted_.east_m.begin());
+    std::copy(state_[1].begin(), state_[1].end(), predicted_.north_m.begin());
+    std::copy(state_[2].begin(), state_[2].end(), predicted_.up_m.begin());
+    for (size_t k = 0; k < 6; ++k) {
+        std::copy(covariance_[PP + k].begin(), covariance_[PP + k].end(),
+                  predicted_.covariance[k].begin());
+    }
+
+    associator_.associate(predicted_, scan_plots_, plot_for_track_);
+
+    // Assigned plots update their filter; the rest start tentative filters
+    auto gather = [&](size_t p) {
+        position[0] = scan_plots_.east_m[p];
+        position[1] = scan_plots_.north_m[p];
+        position[2] = scan_plots_.up_m[p];
+        for (size_t r = 0; r < 3; ++r) {
+            for (size_t c = 0; c < 3; ++c) {
+                position_covariance[r][c] = scan_plots_.covariance[SYM[r][c]][p];
+            }
+        }
+    };
+    plot_used_.assign(plots.size(), 0);
+    for (size_t row = 0; row < filters; ++row) {
+        const uint32_t p = plot_for_track_[row];
+        if (p != NO_PLOT) {
+            plot_used_[p] = 1;
+            gather(p);
+            setPlot(row, position, position_covariance);
+        }
+    }
+    for (size_t p = 0; p < plots.size(); ++p) {
+        if (!plot_used_[p]) {
+            gather(p);
+            addFilter(next_track_id_++, position, position_covariance, time_s);
+        }
+    }
+}
+
+void TrackerBank::setPlot(size_t row, const double (&position)[3],
+                          const double (&position_covariance)[3][3]) {
+    for (size_t k = 0; k < 3; ++k) {
+        plot_[PLOT_POSITION + k][row] = position[k];
+    }
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = r; c < 3; ++c) {
+            plot_[PLOT_COVARIANCE + SYM[r][c]][row] = position_covariance[r][c];
+        }
+    }
+    plot_[PLOT_WEIGHT][row] = 1.0;
+}
+
+bool TrackerBank::isConfirmed(size_t row) const {
+    return config_.routing == PlotRouting::TRACK_ID || plot_count_[row] >= config_.confirm_plots;
+}
+
+Track TrackerBank::rowTrack(size_t row) const {
+    common::EnuState enu;
+    enu.east_m = state_[0][row];
+    enu.north_m = state_[1][row];
+    enu.up_m = state_[2][row];
+    enu.vel_east_ms = state_[3][row];
+    enu.vel_north_ms = state_[4][row];
+    enu.vel_up_ms = state_[5][row];
+    Track track;
+    track.id = id_[row];
+    common::toSpherical(enu, track);
+    return track;
+}
+
+void TrackerBank::prepareTransition(double delta_time_s) {
+    const size_t count = id_.size();
+    for (size_t row = 0; row < count; ++row) {
+        const double turn_rate = turn_rate_rads_[row];
+        const double turn = turn_rate * delta_time_s;
+        if (std::fabs(turn) < SMALL_TURN_RAD) {
+            // Series limit; exactly the constant-velocity model at zero turn
+            transition_[A_COS][row] = delta_time_s * (1.0 - turn * turn / 6.0);
+            transition_[A_SIN][row] = delta_time_s * turn / 2.0;
+            transition_[B_COS][row] = 1.0 - turn * turn / 2.0;
+            transition_[B_SIN][row] = turn;
+        } else {
+            const double sin_turn = std::sin(turn);
+            const double cos_turn = std::cos(turn);
+            transition_[A_COS][row] = sin_turn / turn_rate;
+            transition_[A_SIN][row] = (1.0 - cos_turn) / turn_rate;
+            transition_[B_COS][row] = cos_turn;
+            transition_[B_SIN][row] = sin_turn;
+        }
+    }
+}
+
+void TrackerBank::estimateTurnRates(double time_s) {
+    const bool turning = config_.model == TrackerModel::CONSTANT_TURN;
+    const size_t count = id_.size();
+    for (size_t row = 0; row < count; ++row) {
+        if (plot_[PLOT_WEIGHT][row] == 0.0) {
+            continue;
+        }
+        const double vel_east = state_[3][row];
+        const double vel_north = state_[4][row];
+        const double elapsed_s = time_s - last_plot_time_s_[row];
+
+        // Clockwise angle from the previous updated velocity to this one.
+        // The first updates only settle the velocity, so they are skipped.
+        if (turning && plot_count_[row] >= 2 && elapsed_s > 0.0) {
+            const double last_east = last_vel_east_ms_[row];
+            const double last_north = last_vel_north_ms_[row];
+            const double speed_sq = vel_east * vel_east + vel_north * vel_north;
+            const double last_speed_sq = last_east * last_east + last_north * last_north;
+            if (std::min(speed_sq, last_speed_sq) > MIN_TURN_SPEED_MS * MIN_TURN_SPEED_MS) {
+                const double angle = std::atan2(last_north * vel_east - last_east * vel_north,
+                                                last_east * vel_east + last_north * vel_north);
+                const double observed = angle / elapsed_s;
+                const double weight = elapsed_s / (config_.turn_rate_time_s + elapsed_s);
+                double turn_rate = turn_rate_rads_[row] +
+                                   weight * (observed - turn_rate_rads_[row]);
+                turn_rate_rads_[row] = std::max(-config_.max_turn_rate_rads,
+                                                std::min(config_.max_turn_rate_rads, turn_rate));
+            }
+        }
+        last_vel_east_ms_[row] = vel_east;
+        last_vel_north_ms_[row] = vel_north;
+        last_plot_time_s_[row] = time_s;
+        plot_count_[row]++;
+    }
+}
+
+void TrackerBank::addFilter(uint32_t track_id, const double (&position)[3],
+                            const double (&position_covariance)[3][3], double time_s) {
+    // Position from the plot, velocity unknown
+    const double velocity_variance = config_.initial_velocity_sigma_ms *
+                                     config_.initial_velocity_sigma_ms;
+    for (size_t k = 0; k < 3; ++k) {
+        state_[k].push_back(position[k]);
+        state_[3 + k].push_back(0.0);
+    }
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = r; c < 3; ++c) {
+            covariance_[PP + SYM[r][c]].push_back(position_covariance[r][c]);
+            covariance_[VV + SYM[r][c]].push_back(r == c ? velocity_variance : 0.0);
+        }
+        for (size_t c = 0; c < 3; ++c) {
+            covariance_[PV + 3 * r + c].push_back(0.0);
+        }
+    }
+    for (auto& column : transition_) {
+        column.push_back(0.0);
+    }
+    for (size_t k = 0; k < 3; ++k) {
+        plot_[PLOT_POSITION + k].push_back(position[k]);
+    }
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = r; c < 3; ++c) {
+            plot_[PLOT_COVARIANCE + SYM[r][c]].push_back(position_covariance[r][c]);
+        }
+    }
+    plot_[PLOT_WEIGHT].push_back(1.0);
+
+    id_row_[track_id] = static_cast<uint32_t>(id_.size());
+    id_.push_back(track_id);
+    turn_rate_rads_.push_back(0.0);
+    last_vel_east_ms_.push_back(0.0);
+    last_vel_north_ms_.push_back(0.0);
+    last_plot_time_s_.push_back(time_s);
+    plot_count_.push_back(0);
+    missed_scans_.push_back(0);
+}
+
+void TrackerBank::removeFilter(size_t row) {
+    id_row_.erase(id_[row]);
+    if (row + 1 != id_.size()) {
+        id_row_[id_.back()] = static_cast<uint32_t>(row);
+    }
+    swapPop(id_, row);
+    for (auto& column : state_) swapPop(column, row);
+    for (auto& column : covariance_) swapPop(column, row);
+    for (auto& column : transition_) swapPop(column, row);
+    for (auto& column : plot_) swapPop(column, row);
+    swapPop(turn_rate_rads_, row);
+    swapPop(last_vel_east_ms_, row);
+    swapPop(last_vel_north_ms_, row);
+    swapPop(last_plot_time_s_, row);
+    swapPop(plot_count_, row);
+    swapPop(missed_scans_, row);
+}
+
+bool TrackerBank::findTrack(uint32_t track_id, Track& track) const {
+    auto found = id_row_.find(track_id);
+    if (found == id_row_.end() || !isConfirmed(found->second)) {
+        return false;
+    }
+    track = rowTrack(found->second);
+    return true;
+}
+
+bool TrackerBank::getCovariance(uint32_t track_id, TrackCovariance& covariance) const {
+    auto found = id_row_.find(track_id);
+    if (found == id_row_.end()) {
+        return false;
+    }
+    const size_t row = found->second;
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            covariance.matrix[r][c] = covariance_[PP + SYM[r][c]][row];
+            covariance.matrix[3 + r][3 + c] = covariance_[VV + SYM[r][c]][row];
+            covariance.matrix[r][3 + c] = covariance_[PV + 3 * r + c][row];
+            covariance.matrix[3 + c][r] = covariance_[PV + 3 * r + c][row];
+        }
+    }
+    return true;
+}
+
+void TrackerBank::extrapolate(double time_s, TrackEstimates& estimates) const {
+    const double dt = std::max(0.0, time_s - time_s_);
+    const double q = config_.acceleration_noise;
+    size_t count = 0;
+    for (size_t row = 0; row < id_.size(); ++row) {
+        count += isConfirmed(row);
+    }
+    estimates.resize(count);
+
+    // x' = x + v dt,  PP' = PP + dt (PV + PV^T) + dt^2 VV + q dt^3 / 3
+    size_t out = 0;
+    for (size_t row = 0; row < id_.size(); ++row) {
+        if (!isConfirmed(row)) {
+            continue;
+        }
+        double position[3];
+        double matrix[3][3];
+        for (size_t r = 0; r < 3; ++r) {
+            position[r] = state_[r][row] + dt * state_[3 + r][row];
+            for (size_t c = 0; c < 3; ++c) {
+                matrix[r][c] = covariance_[PP + SYM[r][c]][row] +
+                               dt * (covariance_[PV + 3 * r + c][row] +
+                                     covariance_[PV + 3 * c + r][row]) +
+                               dt * dt * covariance_[VV + SYM[r][c]][row];
+            }
+            matrix[r][r] += q * dt * dt * dt / 3.0;
+        }
+        estimates.id[out] = id_[row];
+        estimates.position.set(out, position, matrix);
+        estimates.vel_east_ms[out] = state_[3][row];
+        estimates.vel_north_ms[out] = state_[4][row];
+        estimates.vel_up_ms[out] = state_[5][row];
+        estimates.velocity_variance[out] =
+            (covariance_[VV + SYM[0][0]][row] + covariance_[VV + SYM[1][1]][row] +
+             covariance_[VV + SYM[2][2]][row]) / 3.0 + q * dt;
+        ++out;
+    }
+}
+
+} // namespace c2
+} // namespace skyguardis
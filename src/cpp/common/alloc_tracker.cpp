@@ -0,0 +1,182 @@
+#include "common/alloc_tracker.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace skyguardis {
+namespace common {
+
+namespace {
+
+std::atomic<uint8_t> current_phase(0);
+std::atomic<uint64_t> phase_allocations[CYCLE_PHASE_COUNT];
+std::atomic<uint64_t> phase_bytes[CYCLE_PHASE_COUNT];
+
+const char* const PHASE_NAMES[CYCLE_PHASE_COUNT] = {
+    "idle", "radar_update", "threat_evaluation", "assignment", "logging", "visualization"
+};
+
+} // namespace
+
+AllocationCounts::AllocationCounts() {
+    for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+        allocations[p] = 0;
+        bytes[p] = 0;
+    }
+}
+
+uint64_t AllocationCounts::total() const {
+    uint64_t sum = 0;
+    for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+        sum += allocations[p];
+    }
+    return sum;
+}
+
+AllocationCounts AllocationCounts::operator-(const AllocationCounts& earlier) const {
+    AllocationCounts difference;
+    for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+        difference.allocations[p] = allocations[p] - earlier.allocations[p];
+        difference.bytes[p] = bytes[p] - earlier.bytes[p];
+    }
+    return difference;
+}
+
+bool allocationTrackingEnabled() {
+#ifdef SKYGUARDIS_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void setAllocationPhase(CyclePhase phase) {
+    current_phase.store(static_cast<uint8_t>(phase), std::memory_order_relaxed);
+}
+
+CyclePhase allocationPhase() {
+    return static_cast<CyclePhase>(current_phase.load(std::memory_order_relaxed));
+}
+
+AllocationCounts allocationCounts() {
+    AllocationCounts counts;
+    for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+        counts.allocations[p] = phase_allocations[p].load(std::memory_order_relaxed);
+        counts.bytes[p] = phase_bytes[p].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+const char* phaseName(CyclePhase phase) {
+    const size_t index = static_cast<size_t>(phase);
+    return index < CYCLE_PHASE_COUNT ? PHASE_NAMES[index] : "unknown";
+}
+
+} // namespace common
+} // namespace skyguardis
+
+#ifdef SKYGUARDIS_TRACK_ALLOCATIONS
+
+// Counting replacements of the global allocation functions. They may run
+// before main() and on any thread, so they touch nothing but the atomics.
+
+namespace {
+
+void countAllocation(size_t bytes) {
+    using namespace skyguardis::common;
+    const size_t phase = current_phase.load(std::memory_order_relaxed);
+    phase_allocations[phase].fetch_add(1, std::memory_order_relaxed);
+    phase_bytes[phase].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+} // namespace
+
+#if defined(__GLIBC__)
+// C allocations (strdup, stdio buffers, ...) as well: interpose malloc and
+// forward to glibc's own entry points. operator new uses those directly so
+// it is not counted twice.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+void* malloc(size_t size) {
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    countAllocation(size);
+    return __libc_realloc(pointer, size);
+}
+}
+
+#define SKYGUARDIS_RAW_MALLOC __libc_malloc
+#else
+#define SKYGUARDIS_RAW_MALLOC std::malloc
+#endif
+
+namespace {
+
+void* countedNew(size_t size) {
+    countAllocation(size);
+    void* pointer = SKYGUARDIS_RAW_MALLOC(size > 0 ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* countedAlignedNew(size_t size, std::align_val_t alignment) {
+    countAllocation(size);
+    void* pointer = nullptr;
+    size_t align = static_cast<size_t>(alignment);
+    if (align < sizeof(void*)) {
+        align = sizeof(void*);
+    }
+    if (posix_memalign(&pointer, align, size > 0 ? size : 1) != 0) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedNew(size); }
+void* operator new[](size_t size) { return countedNew(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return countedAlignedNew(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return countedAlignedNew(size, alignment); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedNew(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedNew(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+#endif // SKYGUARDIS_TRACK_ALLOCATIONS
@@ -0,0 +1,33 @@
+#include "common/enu_frame.hpp"
+#include "c2_controller/threat_evaluator.hpp"
+#include <cmath>
+
+namespace skyguardis {
+namespace common {
+
+EnuState toEnu(const c2::Track& track) {
+    const double horizontal_m = track.range_m * std::cos(track.elevation_rad);
+    EnuState state;
+    state.east_m = horizontal_m * std::sin(track.azimuth_rad);
+    state.north_m = horizontal_m * std::cos(track.azimuth_rad);
+    state.up_m = track.range_m * std::sin(track.elevation_rad);
+    state.vel_east_ms = track.velocity_ms * std::sin(track.heading_rad);
+    state.vel_north_ms = track.velocity_ms * std::cos(track.heading_rad);
+    state.vel_up_ms = 0.0;
+    return state;
+}
+
+void toSpherical(const EnuState& state, c2::Track& track) {
+    const double horizontal_m = std::sqrt(state.east_m * state.east_m +
+                                          state.north_m * state.north_m);
+    track.range_m = std::sqrt(horizontal_m * horizontal_m + state.up_m * state.up_m);
+    track.azimuth_rad = std::atan2(state.east_m, state.north_m);
+    track.elevation_rad = std::atan2(state.up_m, horizontal_m);
+    track.velocity_ms = std::sqrt(state.vel_east_ms * state.vel_east_ms +
+                                  state.vel_north_ms * state.vel_north_ms +
+                                  state.vel_up_ms * state.vel_up_ms);
+    track.heading_rad = std::atan2(state.vel_east_ms, state.vel_north_ms);
+}
+
+} // namespace common
+} // namespace skyguardis
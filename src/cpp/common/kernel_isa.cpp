@@ -0,0 +1,66 @@
+#include "common/kernel_isa.hpp"
+#include <atomic>
+
+namespace skyguardis {
+namespace common {
+
+namespace {
+
+constexpr int ISA_UNSET = -1;
+std::atomic<int> g_active_isa(ISA_UNSET);
+
+bool isSupported(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::SCALAR:
+            return true;
+#ifdef SKYGUARDIS_X86_KERNELS
+        case KernelIsa::SSE41:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case KernelIsa::AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+        case KernelIsa::SSE41:
+        case KernelIsa::AVX2:
+            return false;
+#endif
+    }
+    return false;
+}
+
+} // namespace
+
+KernelIsa detectKernelIsa() {
+    if (isSupported(KernelIsa::AVX2)) return KernelIsa::AVX2;
+    if (isSupported(KernelIsa::SSE41)) return KernelIsa::SSE41;
+    return KernelIsa::SCALAR;
+}
+
+KernelIsa getKernelIsa() {
+    int isa = g_active_isa.load(std::memory_order_relaxed);
+    if (isa == ISA_UNSET) {
+        isa = static_cast<int>(detectKernelIsa());
+        g_active_isa.store(isa, std::memory_order_relaxed);
+    }
+    return static_cast<KernelIsa>(isa);
+}
+
+void setKernelIsa(KernelIsa isa) {
+    if (!isSupported(isa)) {
+        isa = detectKernelIsa();
+    }
+    g_active_isa.store(static_cast<int>(isa), std::memory_order_relaxed);
+}
+
+const char* kernelIsaName(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::SCALAR: return "scalar";
+        case KernelIsa::SSE41:  return "sse4.1";
+        case KernelIsa::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
+
+} // namespace common
+} // namespace skyguardis
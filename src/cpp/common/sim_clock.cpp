@@ -0,0 +1,65 @@
+#include "common/sim_clock.hpp"
+#include <cmath>
+#include <thread>
+
+namespace skyguardis {
+namespace common {
+
+namespace {
+
+int64_t toNanoseconds(double seconds) {
+    return static_cast<int64_t>(std::llround(seconds * 1e9));
+}
+
+} // namespace
+
+double SteadyClock::now() const {
+    auto duration = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(duration).count();
+}
+
+std::chrono::system_clock::time_point SteadyClock::wallTime() const {
+    return std::chrono::system_clock::now();
+}
+
+void SteadyClock::sleepFor(double seconds) {
+    if (seconds > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    }
+}
+
+VirtualClock::VirtualClock(double start_s)
+    : now_ns_(toNanoseconds(start_s)),
+      start_ns_(toNanoseconds(start_s)),
+      wall_anchor_(std::chrono::system_clock::now()) {}
+
+double VirtualClock::now() const {
+    return now_ns_.load(std::memory_order_acquire) / 1e9;
+}
+
+std::chrono::system_clock::time_point VirtualClock::wallTime() const {
+    auto elapsed = std::chrono::nanoseconds(now_ns_.load(std::memory_order_acquire) - start_ns_);
+    return wall_anchor_ + std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed);
+}
+
+void VirtualClock::sleepFor(double seconds) {
+    if (seconds > 0.0) {
+        advance(seconds);
+    }
+}
+
+void VirtualClock::advance(double seconds) {
+    now_ns_.fetch_add(toNanoseconds(seconds), std::memory_order_acq_rel);
+}
+
+void VirtualClock::setTime(double seconds) {
+    now_ns_.store(toNanoseconds(seconds), std::memory_order_release);
+}
+
+Clock& systemClock() {
+    static SteadyClock clock;
+    return clock;
+}
+
+} // namespace common
+} // namespace skyguardis
@@ -1,13 +1,17 @@
 #include "logger/logger.hpp"
-#include <iostream>
-#include <iomanip>
-#include <sstream>
+#include <cstdarg>
+#include <cstdio>
 #include <ctime>
+#include <iostream>
 
 namespace skyguardis {
 namespace logger {
 
-Logger::Logger() : current_level_(LogLevel::INFO), console_output_(true) {}
+Logger::Logger() : current_level_(LogLevel::INFO), console_output_(true),
+                   clock_(&common::systemClock()), arena_(nullptr),
+                   calendar_second_(-1) {
+    calendar_[0] = '\0';
+}
 
 Logger::~Logger() {
     if (log_file_ && log_file_->is_open()) {
@@ -15,19 +19,22 @@ Logger::~Logger() {
     }
 }
 
-std::string Logger::getTimestamp() const {
-    auto now = std::chrono::system_clock::now();
+void Logger::appendTimestamp(common::ArenaText& out) {
+    auto now = clock_->wallTime();
     auto time = std::chrono::system_clock::to_time_t(now);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()) % 1000;
     
-    std::stringstream ss;
-    ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-    ss << "." << std::setfill('0') << std::setw(3) << ms.count();
-    return ss.str();
+    if (time != calendar_second_) {
+        std::tm local;
+        localtime_r(&time, &local);
+        std::strftime(calendar_, sizeof(calendar_), "%Y-%m-%d %H:%M:%S", &local);
+        calendar_second_ = time;
+    }
+    out.appendf("%s.%03d", calendar_, static_cast<int>(ms.count()));
 }
 
-std::string Logger::levelToString(LogLevel level) const {
+const char* Logger::levelToString(LogLevel level) const {
     switch (level) {
         case LogLevel::DEBUG: return "DEBUG";
         case LogLevel::INFO:  return "INFO ";
@@ -38,24 +45,32 @@ std::string Logger::levelToString(LogLevel level) const {
 }
 
 void Logger::writeLog(LogLevel level, const std::string& message) {
-    if (level < current_level_) {
+    writeLog(level, message.data(), message.size());
+}
+
+void Logger::writeLog(LogLevel level, const char* message, size_t length) {
+    if (!isEnabled(level)) {
         return; // Filter by log level
     }
     
     std::lock_guard<std::mutex> lock(log_mutex_);
     
-    std::string timestamp = getTimestamp();
-    std::string level_str = levelToString(level);
-    std::string log_entry = "[" + timestamp + "] [" + level_str + "] " + message;
+    common::ArenaText log_entry(arena_, length + 48);
+    log_entry.append('[');
+    appendTimestamp(log_entry);
+    log_entry.appendf("] [%s] ", levelToString(level));
+    log_entry.append(message, length);
     
     // Console output
     if (console_output_) {
-        std::cout << log_entry << std::endl;
+        std::cout.write(log_entry.c_str(), log_entry.size());
+        std::cout << std::endl;
     }
     
     // File output
     if (log_file_ && log_file_->is_open()) {
-        *log_file_ << log_entry << std::endl;
+        log_file_->write(log_entry.c_str(), log_entry.size());
+        *log_file_ << '\n';
         log_file_->flush();
     }
 }
@@ -84,40 +99,40 @@ void Logger::log(const std::string& message) {
     writeLog(LogLevel::INFO, message);
 }
 
+void Logger::logf(LogLevel level, const char* format, ...) {
+    if (!isEnabled(level)) {
+        return;
+    }
+    common::ArenaText message(arena_);
+    va_list args;
+    va_start(args, format);
+    message.vappendf(format, args);
+    va_end(args);
+    writeLog(level, message.c_str(), message.size());
+}
+
 void Logger::logEngagement(const protocol::EngagementStatus& status) {
-    std::stringstream ss;
-    ss << "Engagement Status: target_id=" << status.target_id
-       << " state=" << static_cast<int>(status.state)
-       << " firing=" << static_cast<int>(status.firing)
-       << " lead_angle=" << status.lead_angle_rad << "rad"
-       << " time_to_impact=" << status.time_to_impact_s << "s";
-    writeLog(LogLevel::INFO, ss.str());
+    logf(LogLevel::INFO,
+         "Engagement Status: target_id=%u state=%d firing=%d lead_angle=%grad time_to_impact=%gs",
+         status.target_id, static_cast<int>(status.state), static_cast<int>(status.firing),
+         status.lead_angle_rad, status.time_to_impact_s);
 }
 
 void Logger::logTargetAssignment(uint32_t target_id, double range_m, double azimuth_rad) {
-    std::stringstream ss;
-    ss << "Target Assignment: id=" << target_id
-       << " range=" << range_m << "m"
-       << " azimuth=" << azimuth_rad << "rad";
-    writeLog(LogLevel::INFO, ss.str());
+    logf(LogLevel::INFO, "Target Assignment: id=%u range=%gm azimuth=%grad",
+         target_id, range_m, azimuth_rad);
 }
 
 void Logger::logStateTransition(const std::string& from_state, const std::string& to_state) {
-    std::stringstream ss;
-    ss << "State Transition: " << from_state << " -> " << to_state;
-    writeLog(LogLevel::INFO, ss.str());
+    logf(LogLevel::INFO, "State Transition: %s -> %s", from_state.c_str(), to_state.c_str());
 }
 
 void Logger::logSafetyViolation(const std::string& reason) {
-    std::stringstream ss;
-    ss << "Safety Violation: " << reason;
-    writeLog(LogLevel::WARN, ss.str());
+    logf(LogLevel::WARN, "Safety Violation: %s", reason.c_str());
 }
 
 void Logger::logError(const std::string& component, const std::string& error) {
-    std::stringstream ss;
-    ss << "[" << component << "] " << error;
-    writeLog(LogLevel::ERROR, ss.str());
+    logf(LogLevel::ERROR, "[%s] %s", component.c_str(), error.c_str());
 }
 
 void Logger::setLogLevel(LogLevel level) {
@@ -141,13 +156,19 @@ void Logger::enableConsoleOutput(bool enable) {
     console_output_ = enable;
 }
 
+void Logger::setClock(common::Clock* clock) {
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    clock_ = clock ? clock : &common::systemClock();
+}
+
+void Logger::setCycleArena(common::CycleArena* arena) {
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    arena_ = arena;
+}
+
 void Logger::logPerformanceMetric(const std::string& metric_name, double value, const std::string& unit) {
-    std::stringstream ss;
-    ss << "Performance [" << metric_name << "]: " << value;
-    if (!unit.empty()) {
-        ss << " " << unit;
-    }
-    writeLog(LogLevel::DEBUG, ss.str());
+    logf(LogLevel::DEBUG, "Performance [%s]: %g%s%s", metric_name.c_str(), value,
+         unit.empty() ? "" : " ", unit.c_str());
 }
 
 } // namespace logger
@@ -1,12 +1,10 @@
 #include "logger/visualizer.hpp"
 #include "c2_controller/threat_evaluator.hpp"
 #include "message_gateway/protocol.hpp"
-#include <iostream>
-#include <iomanip>
-#include <sstream>
-#include <cmath>
-#include <fstream>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
 
 namespace skyguardis {
 namespace logger {
@@ -15,7 +13,8 @@ Visualizer::Visualizer()
     : format_(VisualFormat::ASCII_TABLE),
       update_interval_(10),  // Update every 10 cycles (1 second at 10 Hz)
       cycle_count_(0),
-      auto_clear_(false) {}
+      auto_clear_(false),
+      arena_(nullptr) {}
 
 Visualizer::~Visualizer() {
     if (output_file_ && output_file_->is_open()) {
@@ -42,46 +41,47 @@ void Visualizer::setOutputFile(const std::string& filename) {
     output_file_ = std::make_unique<std::ofstream>(filename, std::ios::app);
 }
 
-void Visualizer::clearScreen() {
+void Visualizer::clearScreen(common::ArenaText& frame) {
     if (auto_clear_) {
-        std::cout << "\033[2J\033[H"; // ANSI escape codes for clear screen
+        frame.append("\033[2J\033[H"); // ANSI escape codes for clear screen
     }
 }
 
-void Visualizer::printHeader() {
-    std::cout << "╔════════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║              SKYGUARDIS Air Defence System Status             ║\n";
-    std::cout << "╚════════════════════════════════════════════════════════════════╝\n";
+void Visualizer::printHeader(common::ArenaText& frame) {
+    frame.append("╔════════════════════════════════════════════════════════════════╗\n");
+    frame.append("║              SKYGUARDIS Air Defence System Status             ║\n");
+    frame.append("╚════════════════════════════════════════════════════════════════╝\n");
 }
 
-void Visualizer::printSeparator() {
-    std::cout << "────────────────────────────────────────────────────────────────\n";
+void Visualizer::printSeparator(common::ArenaText& frame) {
+    frame.append("────────────────────────────────────────────────────────────────\n");
 }
 
-std::string Visualizer::formatAngle(double radians) const {
+void Visualizer::printFrame(const common::ArenaText& frame) {
+    std::cout.write(frame.c_str(), frame.size());
+}
+
+const char* Visualizer::formatAngle(double radians, char* out) const {
     double degrees = radians * 180.0 / 3.14159265359;
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(1) << degrees << "°";
-    return ss.str();
+    std::snprintf(out, FIELD_CHARS, "%.1f°", degrees);
+    return out;
 }
 
-std::string Visualizer::formatRange(double meters) const {
-    std::stringstream ss;
+const char* Visualizer::formatRange(double meters, char* out) const {
     if (meters >= 1000.0) {
-        ss << std::fixed << std::setprecision(1) << (meters / 1000.0) << " km";
+        std::snprintf(out, FIELD_CHARS, "%.1f km", meters / 1000.0);
     } else {
-        ss << std::fixed << std::setprecision(0) << meters << " m";
+        std::snprintf(out, FIELD_CHARS, "%.0f m", meters);
     }
-    return ss.str();
+    return out;
 }
 
-std::string Visualizer::formatVelocity(double ms) const {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(0) << ms << " m/s";
-    return ss.str();
+const char* Visualizer::formatVelocity(double ms, char* out) const {
+    std::snprintf(out, FIELD_CHARS, "%.0f m/s", ms);
+    return out;
 }
 
-std::string Visualizer::getStateString(uint8_t state) const {
+const char* Visualizer::getStateString(uint8_t state) const {
     switch (state) {
         case 0: return "IDLE";
         case 1: return "ACQUIRING";
@@ -93,18 +93,18 @@ std::string Visualizer::getStateString(uint8_t state) const {
     }
 }
 
-std::string Visualizer::getSafetyStatusString(bool is_safe) const {
+const char* Visualizer::getSafetyStatusString(bool is_safe) const {
     return is_safe ? "✓ SAFE" : "✗ UNSAFE";
 }
 
-void Visualizer::writeToFile(const std::string& content) {
+void Visualizer::writeToFile(const common::ArenaText& content) {
     if (output_file_ && output_file_->is_open()) {
-        *output_file_ << content;
+        output_file_->write(content.c_str(), content.size());
         output_file_->flush();
     }
 }
 
-void Visualizer::visualizeTracks(const std::vector<c2::Track>& tracks) {
+void Visualizer::visualizeTracks(c2::TrackSpan tracks) {
     cycle_count_++;
     if (cycle_count_ % update_interval_ != 0) {
         return; // Skip this cycle
@@ -123,54 +123,54 @@ void Visualizer::visualizeTracks(const std::vector<c2::Track>& tracks) {
     }
 }
 
-void Visualizer::visualizeTracksTable(const std::vector<c2::Track>& tracks) {
-    clearScreen();
-    printHeader();
+void Visualizer::visualizeTracksTable(c2::TrackSpan tracks) {
+    // Header, separators and one 66-column row per track
+    common::ArenaText frame(arena_, 1024 + tracks.size() * 80);
+    clearScreen(frame);
+    printHeader(frame);
     
-    std::cout << "\n📡 ACTIVE TRACKS: " << tracks.size() << "\n";
-    printSeparator();
+    frame.appendf("\n📡 ACTIVE TRACKS: %zu\n", tracks.size());
+    printSeparator(frame);
     
     if (tracks.empty()) {
-        std::cout << "  No active tracks\n";
+        frame.append("  No active tracks\n");
     } else {
-        std::cout << std::left 
-                  << std::setw(8) << "ID"
-                  << std::setw(12) << "Range"
-                  << std::setw(12) << "Azimuth"
-                  << std::setw(12) << "Elevation"
-                  << std::setw(12) << "Velocity"
-                  << std::setw(10) << "Heading"
-                  << "\n";
-        printSeparator();
+        frame.appendf("%-8s%-12s%-12s%-12s%-12s%-10s\n",
+                      "ID", "Range", "Azimuth", "Elevation", "Velocity", "Heading");
+        printSeparator(frame);
         
+        char range[FIELD_CHARS], azimuth[FIELD_CHARS], elevation[FIELD_CHARS];
+        char velocity[FIELD_CHARS], heading[FIELD_CHARS];
         for (const auto& track : tracks) {
-            std::cout << std::left
-                      << std::setw(8) << track.id
-                      << std::setw(12) << formatRange(track.range_m)
-                      << std::setw(12) << formatAngle(track.azimuth_rad)
-                      << std::setw(12) << formatAngle(track.elevation_rad)
-                      << std::setw(12) << formatVelocity(track.velocity_ms)
-                      << std::setw(10) << formatAngle(track.heading_rad)
-                      << "\n";
+            frame.appendf("%-8u%-12s%-12s%-12s%-12s%-10s\n", track.id,
+                          formatRange(track.range_m, range),
+                          formatAngle(track.azimuth_rad, azimuth),
+                          formatAngle(track.elevation_rad, elevation),
+                          formatVelocity(track.velocity_ms, velocity),
+                          formatAngle(track.heading_rad, heading));
         }
     }
     
-    printSeparator();
+    printSeparator(frame);
+    printFrame(frame);
     
     // Write to file if configured
-    std::stringstream ss;
-    ss << "Tracks: " << tracks.size() << "\n";
-    writeToFile(ss.str());
+    common::ArenaText summary(arena_, 32);
+    summary.appendf("Tracks: %zu\n", tracks.size());
+    writeToFile(summary);
 }
 
-void Visualizer::visualizeTracksCompact(const std::vector<c2::Track>& tracks) {
-    std::cout << "[TRACKS: " << tracks.size();
+void Visualizer::visualizeTracksCompact(c2::TrackSpan tracks) {
+    common::ArenaText frame(arena_, 64);
+    frame.appendf("[TRACKS: %zu", tracks.size());
     if (!tracks.empty()) {
-        std::cout << " | ID:" << tracks[0].id 
-                  << " R:" << formatRange(tracks[0].range_m)
-                  << " V:" << formatVelocity(tracks[0].velocity_ms);
+        char range[FIELD_CHARS], velocity[FIELD_CHARS];
+        frame.appendf(" | ID:%u R:%s V:%s", tracks[0].id,
+                      formatRange(tracks[0].range_m, range),
+                      formatVelocity(tracks[0].velocity_ms, velocity));
     }
-    std::cout << "]\n";
+    frame.append("]\n");
+    printFrame(frame);
 }
 
 void Visualizer::visualizeEngagementStatus(const protocol::EngagementStatus& status) {
@@ -183,56 +183,61 @@ void Visualizer::visualizeEngagementStatus(const protocol::EngagementStatus& sta
 }
 
 void Visualizer::visualizeEngagementStatusDetailed(const protocol::EngagementStatus& status) {
-    std::cout << "\n🎯 ENGAGEMENT STATUS\n";
-    printSeparator();
-    std::cout << "  Target ID:      " << status.target_id << "\n";
-    std::cout << "  State:          " << getStateString(status.state) << "\n";
-    std::cout << "  Firing:         " << (status.firing ? "YES" : "NO") << "\n";
-    std::cout << "  Lead Angle:     " << formatAngle(status.lead_angle_rad) << "\n";
-    std::cout << "  Time to Impact: " << std::fixed << std::setprecision(2) 
-              << status.time_to_impact_s << " s\n";
-    printSeparator();
+    common::ArenaText frame(arena_, 512);
+    char lead_angle[FIELD_CHARS];
+    frame.append("\n🎯 ENGAGEMENT STATUS\n");
+    printSeparator(frame);
+    frame.appendf("  Target ID:      %u\n", status.target_id);
+    frame.appendf("  State:          %s\n", getStateString(status.state));
+    frame.appendf("  Firing:         %s\n", status.firing ? "YES" : "NO");
+    frame.appendf("  Lead Angle:     %s\n", formatAngle(status.lead_angle_rad, lead_angle));
+    frame.appendf("  Time to Impact: %.2f s\n", status.time_to_impact_s);
+    printSeparator(frame);
+    printFrame(frame);
     
     // Write to file
-    std::stringstream ss;
-    ss << "Engagement: Target=" << status.target_id 
-       << " State=" << getStateString(status.state)
-       << " Firing=" << (status.firing ? "YES" : "NO") << "\n";
-    writeToFile(ss.str());
+    common::ArenaText summary(arena_, 64);
+    summary.appendf("Engagement: Target=%u State=%s Firing=%s\n", status.target_id,
+                    getStateString(status.state), status.firing ? "YES" : "NO");
+    writeToFile(summary);
 }
 
 void Visualizer::visualizeSafetyStatus(bool is_safe, const std::string& reason) {
-    std::cout << "\n🛡️  SAFETY STATUS: " << getSafetyStatusString(is_safe);
+    common::ArenaText frame(arena_, 64);
+    frame.appendf("\n🛡️  SAFETY STATUS: %s", getSafetyStatusString(is_safe));
     if (!reason.empty()) {
-        std::cout << " (" << reason << ")";
+        frame.appendf(" (%s)", reason.c_str());
     }
-    std::cout << "\n";
+    frame.append("\n");
+    printFrame(frame);
     
     // Write to file
-    std::stringstream ss;
-    ss << "Safety: " << (is_safe ? "SAFE" : "UNSAFE");
+    common::ArenaText summary(arena_, 64);
+    summary.appendf("Safety: %s", is_safe ? "SAFE" : "UNSAFE");
     if (!reason.empty()) {
-        ss << " - " << reason;
+        summary.appendf(" - %s", reason.c_str());
     }
-    ss << "\n";
-    writeToFile(ss.str());
+    summary.append("\n");
+    writeToFile(summary);
 }
 
 void Visualizer::visualizeSafetyViolation(const std::string& violation_type, const std::string& details) {
-    std::cout << "\n⚠️  SAFETY VIOLATION DETECTED\n";
-    printSeparator();
-    std::cout << "  Type:    " << violation_type << "\n";
-    std::cout << "  Details: " << details << "\n";
-    printSeparator();
+    common::ArenaText frame(arena_, 256);
+    frame.append("\n⚠️  SAFETY VIOLATION DETECTED\n");
+    printSeparator(frame);
+    frame.appendf("  Type:    %s\n", violation_type.c_str());
+    frame.appendf("  Details: %s\n", details.c_str());
+    printSeparator(frame);
+    printFrame(frame);
     
     // Write to file
-    std::stringstream ss;
-    ss << "SAFETY VIOLATION: " << violation_type << " - " << details << "\n";
-    writeToFile(ss.str());
+    common::ArenaText summary(arena_, 128);
+    summary.appendf("SAFETY VIOLATION: %s - %s\n", violation_type.c_str(), details.c_str());
+    writeToFile(summary);
 }
 
 void Visualizer::visualizeDashboard(
-    const std::vector<c2::Track>& tracks,
+    c2::TrackSpan tracks,
     const protocol::EngagementStatus& status,
     bool safety_status
 ) {
@@ -241,8 +246,10 @@ void Visualizer::visualizeDashboard(
         return;
     }
     
-    clearScreen();
-    printHeader();
+    common::ArenaText frame(arena_, 512);
+    clearScreen(frame);
+    printHeader(frame);
+    printFrame(frame);
     
     // Tracks section
     visualizeTracksTable(tracks);
@@ -256,7 +263,7 @@ void Visualizer::visualizeDashboard(
     std::cout << "\n";
 }
 
-void Visualizer::visualize(const std::vector<c2::Track>& tracks) {
+void Visualizer::visualize(c2::TrackSpan tracks) {
     visualizeTracks(tracks);
 }
 
@@ -1,6 +1,12 @@
 #include "c2_controller/c2_controller.hpp"
+#include "c2_controller/threat_policy.hpp"
+#include "c2_controller/tracker_bank.hpp"
+#include "common/alloc_tracker.hpp"
+#include "common/cycle_arena.hpp"
+#include "common/sim_clock.hpp"
 #include "radar_simulator/radar_simulator.hpp"
 #include "message_gateway/message_gateway.hpp"
+#include "message_gateway/track_stream.hpp"
 #include "logger/logger.hpp"
 #include "logger/visualizer.hpp"
 #include <iostream>
@@ -8,6 +14,11 @@
 #include <thread>
 #include <csignal>
 #include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
 
 std::atomic<bool> running(true);
 
@@ -15,18 +26,114 @@ void signalHandler(int signal) {
     running = false;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     std::signal(SIGINT, signalHandler);
     std::signal(SIGTERM, signalHandler);
     
-    std::cout << "[C2_NODE] SKYGUARDIS C2 Node starting..." << std::endl;
+    // Command line:
+    //   --virtual-time   advance simulated time as fast as the CPU allows
+    //   --cycles N       stop after N control cycles (0 = run until signalled)
+    //   --record FILE    record the simulated track picture every cycle
+    //   --replay FILE    feed a recording to the C2 pipeline instead of the simulator
+    //   --track-port P   ingest tracks streamed by a separate radar_sim process
+    //   --tracker        track the simulator's noisy plots instead of its truth
+    //   --associate      with --tracker, associate the plots by position (ids ignored)
+    //   --pd P           with --tracker, detection probability of the sensor
+    //   --clutter N      with --tracker, mean false alarms per scan
+    //   --threat-model M threat scoring policy: range (default) or cpa (closest approach)
+    bool virtual_time = false;
+    long max_cycles = 0;
+    std::string record_path;
+    std::string replay_path;
+    long track_port = 0;
+    bool use_tracker = false;
+    bool associate_plots = false;
+    skyguardis::radar::SensorConfig sensor_config;
+    const skyguardis::c2::ThreatPolicy* threat_policy = skyguardis::c2::threatPolicy(0);
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--virtual-time") == 0) {
+            virtual_time = true;
+        } else if (std::strcmp(argv[i], "--cycles") == 0 && i + 1 < argc) {
+            max_cycles = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--track-port") == 0 && i + 1 < argc) {
+            track_port = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--tracker") == 0) {
+            use_tracker = true;
+        } else if (std::strcmp(argv[i], "--associate") == 0) {
+            associate_plots = true;
+        } else if (std::strcmp(argv[i], "--pd") == 0 && i + 1 < argc) {
+            sensor_config.detection_probability = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--clutter") == 0 && i + 1 < argc) {
+            sensor_config.false_alarms_per_scan = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threat-model") == 0 && i + 1 < argc &&
+                   skyguardis::c2::findThreatPolicy(argv[i + 1])) {
+            threat_policy = skyguardis::c2::findThreatPolicy(argv[++i]);
+        } else {
+            std::string policies;
+            for (size_t p = 0; p < skyguardis::c2::threatPolicyCount(); ++p) {
+                policies += (p ? "|" : "");
+                policies += skyguardis::c2::threatPolicy(p)->name;
+            }
+            std::cerr << "Usage: " << argv[0]
+                      << " [--virtual-time] [--cycles N] [--tracker [--associate] [--pd P] [--clutter N]]"
+                      << " [--threat-model " << policies << "]"
+                      << " [--record FILE | --replay FILE | --track-port P]" << std::endl;
+            return 1;
+        }
+    }
+    
+    std::cout << "[C2_NODE] SKYGUARDIS C2 Node starting..."
+              << (virtual_time ? " (virtual time)" : "") << std::endl;
+    
+    // Time source shared by every component
+    std::unique_ptr<skyguardis::common::VirtualClock> virtual_clock;
+    skyguardis::common::Clock* clock = &skyguardis::common::systemClock();
+    if (virtual_time) {
+        virtual_clock = std::make_unique<skyguardis::common::VirtualClock>();
+        clock = virtual_clock.get();
+    }
     
     // Initialize components
     skyguardis::radar::RadarSimulator radar;
+    radar.setClock(clock);
     skyguardis::c2::C2Controller c2;
+    c2.setThreatPolicy(*threat_policy);
     skyguardis::logger::Logger logger;
     skyguardis::logger::Visualizer visualizer;
     skyguardis::gateway::MessageGateway gateway;
+    logger.setClock(clock);
+    
+    // Recorded track source (replaces the simulator when given)
+    skyguardis::radar::TrackReplay replay;
+    size_t replay_frame = 0;
+    if (!replay_path.empty() && !replay.open(replay_path)) {
+        std::cerr << "[C2_NODE] Failed to open recording " << replay_path << std::endl;
+        return 1;
+    }
+    
+    // Kalman tracker over the simulator's plots (--tracker)
+    skyguardis::c2::TrackerConfig tracker_config;
+    if (associate_plots) {
+        tracker_config.routing = skyguardis::c2::PlotRouting::ASSOCIATION;
+    }
+    skyguardis::c2::TrackerBank tracker(tracker_config);
+    radar.setSensorConfig(sensor_config);
+    std::vector<skyguardis::c2::Measurement> plots;
+    
+    // Streamed track source from radar_sim (replaces the simulator when given)
+    skyguardis::gateway::TrackStreamReceiver track_stream;
+    if (track_port > 0 && !track_stream.initialize(static_cast<uint16_t>(track_port))) {
+        std::cerr << "[C2_NODE] Failed to bind track port " << track_port << std::endl;
+        return 1;
+    }
+    if (!record_path.empty() && !radar.startRecording(record_path)) {
+        std::cerr << "[C2_NODE] Failed to create recording " << record_path << std::endl;
+        return 1;
+    }
     
     // Initialize message gateway
     if (!gateway.initialize(8888, 8889)) {
@@ -48,25 +155,64 @@ int main() {
     visualizer.enableAutoClear(false); // Don't clear screen (for log files)
     visualizer.setOutputFile("logs/visualization.log");
     
-    // Performance monitoring
-    auto cycle_start_time = std::chrono::steady_clock::now();
+    // Per-cycle scratch (threat scores, log lines, display frames), rewound
+    // at the end of every cycle so steady-state cycles do not call malloc
+    skyguardis::common::CycleArena cycle_arena;
+    c2.setCycleArena(&cycle_arena);
+    logger.setCycleArena(&cycle_arena);
+    visualizer.setCycleArena(&cycle_arena);
+    
+    // Performance monitoring (real processing time, independent of the clock)
     int cycle = 0;
     double total_cycle_time = 0.0;
     
-    // Main control loop
-    while (running) {
+    // Heap allocations per cycle phase (counted only in builds with
+    // SKYGUARDIS_TRACK_ALLOCATIONS); cycles after the warm-up should not
+    // allocate at all
+    const int ALLOCATION_WARMUP_CYCLES = 10;
+    skyguardis::common::AllocationCounts steady_allocations;
+    int allocating_cycles = 0;
+    
+    // Main control loop, paced at 10 Hz by the shared clock
+    while (running && (max_cycles <= 0 || cycle < max_cycles)) {
+        if (replay.isOpen() && replay_frame >= replay.frameCount()) {
+            break; // Recording exhausted
+        }
+        clock->sleepFor(0.1);
         auto cycle_begin = std::chrono::steady_clock::now();
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const skyguardis::common::AllocationCounts allocations_before =
+            skyguardis::common::allocationCounts();
         
         try {
-            // Update and process tracks (with motion models)
-            radar.updateTracks();
-            auto tracks = radar.getCurrentTracks();
+            // Current picture, read in place: either the next recorded frame
+            // (straight from the mapped file) or the simulator's snapshot
+            skyguardis::c2::TrackSpan tracks;
+            skyguardis::common::setAllocationPhase(skyguardis::common::CyclePhase::RADAR_UPDATE);
+            if (replay.isOpen()) {
+                tracks = replay.frame(replay_frame++);
+            } else if (track_stream.isInitialized()) {
+                // Latest complete cycle received from radar_sim
+                track_stream.poll();
+                tracks = track_stream.getTracks();
+            } else {
+                // Update and process tracks (with motion models)
+                radar.updateTracks(0.1);
+                if (use_tracker) {
+                    radar.getMeasurements(plots);
+                    tracker.processScan(plots, clock->now());
+                    tracks = tracker.getTracks();
+                } else {
+                    tracks = radar.getSnapshot().tracks;
+                }
+            }
+            
+            skyguardis::common::setAllocationPhase(skyguardis::common::CyclePhase::IDLE);
             
             if (!tracks.empty()) {
                 c2.processTracks(tracks);
-                logger.debug("Cycle " + std::to_string(cycle) + ": Processed " + 
-                          std::to_string(tracks.size()) + " tracks");
+                skyguardis::common::AllocationPhase phase(skyguardis::common::CyclePhase::LOGGING);
+                logger.logf(skyguardis::logger::LogLevel::DEBUG, "Cycle %d: Processed %zu tracks",
+                            cycle, tracks.size());
                 
                 // Log target assignments
                 for (const auto& track : tracks) {
@@ -80,8 +226,10 @@ int main() {
             bool safety_status = true; // Default safe
             
             if (has_status) {
+                skyguardis::common::AllocationPhase phase(skyguardis::common::CyclePhase::LOGGING);
                 logger.logEngagement(status);
-                logger.logStateTransition("Previous", "State_" + std::to_string(status.state));
+                logger.logf(skyguardis::logger::LogLevel::INFO, "State Transition: Previous -> State_%d",
+                            static_cast<int>(status.state));
                 
                 // Determine safety status from engagement state
                 if (status.state == 0) { // Idle
@@ -90,12 +238,14 @@ int main() {
             }
             
             // Visualize dashboard (tracks + engagement status if available)
+            skyguardis::common::setAllocationPhase(skyguardis::common::CyclePhase::VISUALIZATION);
             if (has_status) {
                 visualizer.visualizeDashboard(tracks, status, safety_status);
             } else {
                 // Visualize tracks only if no engagement status
                 visualizer.visualizeTracks(tracks);
             }
+            skyguardis::common::setAllocationPhase(skyguardis::common::CyclePhase::IDLE);
             
             // Performance monitoring
             auto cycle_end = std::chrono::steady_clock::now();
@@ -105,8 +255,9 @@ int main() {
             
             cycle++;
             if (cycle % 100 == 0) {
+                skyguardis::common::AllocationPhase phase(skyguardis::common::CyclePhase::LOGGING);
                 double avg_cycle_time = total_cycle_time / 100.0;
-                logger.info("C2 Node running - cycle " + std::to_string(cycle));
+                logger.logf(skyguardis::logger::LogLevel::INFO, "C2 Node running - cycle %d", cycle);
                 logger.logPerformanceMetric("avg_cycle_time", avg_cycle_time, "ms");
                 logger.logPerformanceMetric("active_tracks", static_cast<double>(tracks.size()));
                 total_cycle_time = 0.0;
@@ -117,8 +268,52 @@ int main() {
         } catch (...) {
             logger.error("C2 Node unknown error occurred");
         }
+        skyguardis::common::setAllocationPhase(skyguardis::common::CyclePhase::IDLE);
+        cycle_arena.reset();
+        
+        if (cycle > ALLOCATION_WARMUP_CYCLES) {
+            const skyguardis::common::AllocationCounts cycle_allocations =
+                skyguardis::common::allocationCounts() - allocations_before;
+            if (cycle_allocations.total() > 0) {
+                allocating_cycles++;
+            }
+            for (size_t p = 0; p < skyguardis::common::CYCLE_PHASE_COUNT; ++p) {
+                steady_allocations.allocations[p] += cycle_allocations.allocations[p];
+                steady_allocations.bytes[p] += cycle_allocations.bytes[p];
+            }
+        }
+    }
+    
+    const auto& arena_stats = cycle_arena.getStats();
+    logger.logf(skyguardis::logger::LogLevel::INFO,
+                "Cycle arena: %zu KB peak, %llu system allocations (%llu in the last cycle)",
+                arena_stats.peak_bytes / 1024,
+                static_cast<unsigned long long>(arena_stats.system_allocations),
+                static_cast<unsigned long long>(arena_stats.last_cycle_system_allocations));
+    if (skyguardis::common::allocationTrackingEnabled()) {
+        logger.logf(skyguardis::logger::LogLevel::INFO,
+                    "Heap allocations after %d warm-up cycles: %d allocating cycles, %llu total",
+                    ALLOCATION_WARMUP_CYCLES, allocating_cycles,
+                    static_cast<unsigned long long>(steady_allocations.total()));
+        for (size_t p = 0; p < skyguardis::common::CYCLE_PHASE_COUNT; ++p) {
+            const auto phase = static_cast<skyguardis::common::CyclePhase>(p);
+            if (steady_allocations.of(phase) > 0) {
+                logger.logf(skyguardis::logger::LogLevel::INFO, "  %s: %llu allocations, %llu bytes",
+                            skyguardis::common::phaseName(phase),
+                            static_cast<unsigned long long>(steady_allocations.allocations[p]),
+                            static_cast<unsigned long long>(steady_allocations.bytes[p]));
+            }
+        }
     }
     
+    radar.stopRecording();
+    if (track_stream.isInitialized()) {
+        const auto& stream_stats = track_stream.getStats();
+        logger.info("Track stream: " + std::to_string(stream_stats.cycles_completed) + " cycles, " +
+                    std::to_string(stream_stats.cycles_dropped) + " dropped, " +
+                    std::to_string(stream_stats.reports_rejected) + " rejected reports");
+        track_stream.shutdown();
+    }
     gateway.shutdown();
     logger.info("C2 Node shutting down gracefully");
     std::cout << "[C2_NODE] Shutdown complete" << std::endl;
@@ -1,13 +1,166 @@
 #include "radar_simulator/radar_simulator.hpp"
+#include "message_gateway/track_stream.hpp"
 #include <iostream>
+#include <chrono>
+#include <thread>
+#include <csignal>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <algorithm>
 
-int main() {
+std::atomic<bool> running(true);
+
+void signalHandler(int) {
+    running = false;
+}
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --scenario NAME   single | swarm | saturation | mass-raid | scripted (default: single)\n"
+              << "  --script FILE     scenario script for --scenario scripted\n"
+              << "  --targets N       target count (clamped per scenario)\n"
+              << "  --waves N         mass raid arrival waves\n"
+              << "  --spawn-rate R    mass raid tracks per second per wave (0 = whole wave at once)\n"
+              << "  --rate HZ         radar cycles per second (default: 10)\n"
+              << "  --cycles N        stop after N cycles (0 = run until signalled)\n"
+              << "  --workers N       threads for the track update\n"
+              << "  --seed S          fixed random seed\n"
+              << "  --host ADDR       C2 node address (default: 127.0.0.1)\n"
+              << "  --port P          C2 node track port (default: "
+              << skyguardis::gateway::DEFAULT_TRACK_STREAM_PORT << ")" << std::endl;
+}
+
+bool parseScenario(const std::string& name, skyguardis::radar::ScenarioType& type) {
+    using skyguardis::radar::ScenarioType;
+    if (name == "single") type = ScenarioType::SINGLE_TARGET;
+    else if (name == "swarm") type = ScenarioType::SWARM;
+    else if (name == "saturation") type = ScenarioType::SATURATION;
+    else if (name == "mass-raid") type = ScenarioType::MASS_RAID;
+    else if (name == "scripted") type = ScenarioType::SCRIPTED;
+    else return false;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+    
+    skyguardis::radar::ScenarioType scenario = skyguardis::radar::ScenarioType::SINGLE_TARGET;
+    skyguardis::radar::ScenarioConfig config;
+    double rate_hz = 10.0;
+    long max_cycles = 0;
+    long workers = 1;
+    bool seeded = false;
+    uint64_t seed = 0;
+    std::string script;
+    std::string host = "127.0.0.1";
+    uint16_t port = skyguardis::gateway::DEFAULT_TRACK_STREAM_PORT;
+    
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--scenario") == 0 && has_value) {
+            if (!parseScenario(argv[++i], scenario)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--script") == 0 && has_value) {
+            script = argv[++i];
+        } else if (std::strcmp(argv[i], "--targets") == 0 && has_value) {
+            config.target_count = static_cast<uint32_t>(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--waves") == 0 && has_value) {
+            config.wave_count = static_cast<uint32_t>(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--spawn-rate") == 0 && has_value) {
+            config.spawn_rate_per_s = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--rate") == 0 && has_value) {
+            rate_hz = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--cycles") == 0 && has_value) {
+            max_cycles = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--workers") == 0 && has_value) {
+            workers = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && has_value) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            seeded = true;
+        } else if (std::strcmp(argv[i], "--host") == 0 && has_value) {
+            host = argv[++i];
+        } else if (std::strcmp(argv[i], "--port") == 0 && has_value) {
+            port = static_cast<uint16_t>(std::atoi(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (rate_hz <= 0.0 || (scenario == skyguardis::radar::ScenarioType::SCRIPTED) == script.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    
     std::cout << "SKYGUARDIS Radar Simulator starting..." << std::endl;
     
     skyguardis::radar::RadarSimulator radar;
+    if (seeded) {
+        radar.setRandomSeed(seed);
+    }
+    radar.setWorkerCount(static_cast<size_t>(workers > 0 ? workers : 1));
+    if (!script.empty() && !radar.loadScript(script)) {
+        std::cerr << "[RADAR_SIM] Failed to load " << script << ": "
+                  << radar.getScriptError() << std::endl;
+        return 1;
+    }
+    radar.setScenario(scenario, config);
     
-    // Main simulation loop would go here
+    skyguardis::gateway::TrackStreamSender sender;
+    if (!sender.initialize(port, host.c_str())) {
+        std::cerr << "[RADAR_SIM] Failed to open track stream to " << host << ":" << port << std::endl;
+        return 1;
+    }
+    std::cout << "[RADAR_SIM] Streaming " << radar.getActiveTrackCount() << " tracks to "
+              << host << ":" << port << " at " << rate_hz << " Hz" << std::endl;
     
+    // Fixed-rate loop on an absolute schedule; if a cycle overruns, the
+    // schedule restarts from now rather than bursting to catch up
+    const double period_s = 1.0 / rate_hz;
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(period_s));
+    auto next_tick = std::chrono::steady_clock::now();
+    uint32_t cycle = 0;
+    uint64_t overruns = 0;
+    const long report_every = std::max(1L, static_cast<long>(rate_hz));
+    
+    while (running && (max_cycles <= 0 || cycle < max_cycles)) {
+        radar.updateTracks(period_s);
+        auto snapshot = radar.getSnapshot();
+        if (!sender.sendTracks(cycle, snapshot.tracks)) {
+            std::cerr << "[RADAR_SIM] Failed to send cycle " << cycle << std::endl;
+        }
+        cycle++;
+        
+        if (cycle % report_every == 0) {
+            auto stats = radar.getCycleStats();
+            std::cout << "[RADAR_SIM] cycle " << cycle
+                      << " tracks=" << snapshot.tracks.size()
+                      << " update_ms=" << stats.last_update_ms
+                      << " max_update_ms=" << stats.max_update_ms
+                      << " datagrams=" << sender.getDatagramsSent()
+                      << " overruns=" << overruns << std::endl;
+        }
+        
+        next_tick += period;
+        auto now = std::chrono::steady_clock::now();
+        if (next_tick > now) {
+            std::this_thread::sleep_until(next_tick);
+        } else {
+            overruns++;
+            next_tick = now;
+        }
+    }
+    
+    sender.shutdown();
+    std::cout << "[RADAR_SIM] Stopped after " << cycle << " cycles" << std::endl;
     return 0;
 }
-
@@ -207,5 +207,133 @@ bool deserializeEngagementStatus(const uint8_t* buffer, size_t buffer_size, Enga
     return true;
 }
 
+// Serialize TrackReport message
+bool serializeTrackReport(const TrackReport& report, const c2::Track* tracks,
+                          uint8_t* buffer, size_t buffer_size) {
+    if (report.track_count > TrackReport::MAX_TRACKS ||
+        buffer_size < TrackReport::serializedSize(report.track_count)) {
+        return false;
+    }
+    
+    size_t offset = 0;
+    
+    // Header
+    buffer[offset++] = static_cast<uint8_t>(MessageType::TRACK_REPORT);
+    buffer[offset++] = 0x01; // Version
+    uint16_t length = htons(static_cast<uint16_t>(
+        TrackReport::serializedSize(report.track_count) - 6)); // Payload size
+    std::memcpy(buffer + offset, &length, 2);
+    offset += 2;
+    
+    // Placeholder for checksum
+    uint16_t checksum_pos = offset;
+    offset += 2;
+    
+    // Report fields
+    uint32_t cycle_net = htonl(report.cycle);
+    std::memcpy(buffer + offset, &cycle_net, 4);
+    offset += 4;
+    uint16_t batch_index_net = htons(report.batch_index);
+    std::memcpy(buffer + offset, &batch_index_net, 2);
+    offset += 2;
+    uint16_t batch_count_net = htons(report.batch_count);
+    std::memcpy(buffer + offset, &batch_count_net, 2);
+    offset += 2;
+    uint16_t track_count_net = htons(report.track_count);
+    std::memcpy(buffer + offset, &track_count_net, 2);
+    offset += 2;
+    
+    // Tracks (doubles in host order, as for the other messages)
+    for (size_t i = 0; i < report.track_count; ++i) {
+        const c2::Track& track = tracks[i];
+        uint32_t id_net = htonl(track.id);
+        std::memcpy(buffer + offset, &id_net, 4);
+        std::memcpy(buffer + offset + 4, &track.range_m, 8);
+        std::memcpy(buffer + offset + 12, &track.azimuth_rad, 8);
+        std::memcpy(buffer + offset + 20, &track.elevation_rad, 8);
+        std::memcpy(buffer + offset + 28, &track.velocity_ms, 8);
+        std::memcpy(buffer + offset + 36, &track.heading_rad, 8);
+        offset += TrackReport::TRACK_SIZE;
+    }
+    
+    // Calculate and write checksum
+    uint16_t checksum = calculateChecksum(buffer, checksum_pos);
+    checksum += calculateChecksum(buffer + checksum_pos + 2, offset - checksum_pos - 2);
+    checksum &= 0xFFFF;
+    uint16_t checksum_net = htons(checksum);
+    std::memcpy(buffer + checksum_pos, &checksum_net, 2);
+    
+    return true;
+}
+
+// Deserialize TrackReport message
+bool deserializeTrackReport(const uint8_t* buffer, size_t buffer_size, TrackReport& report,
+                            c2::Track* tracks, size_t max_tracks) {
+    if (buffer_size < TrackReport::HEADER_SIZE) {
+        return false;
+    }
+    
+    // Validate message type
+    if (buffer[0] != static_cast<uint8_t>(MessageType::TRACK_REPORT)) {
+        return false;
+    }
+    
+    // Validate version
+    if (buffer[1] != 0x01) {
+        return false;
+    }
+    
+    // Report fields
+    size_t offset = 6;
+    uint32_t cycle_net;
+    std::memcpy(&cycle_net, buffer + offset, 4);
+    report.cycle = ntohl(cycle_net);
+    offset += 4;
+    uint16_t value_net;
+    std::memcpy(&value_net, buffer + offset, 2);
+    report.batch_index = ntohs(value_net);
+    offset += 2;
+    std::memcpy(&value_net, buffer + offset, 2);
+    report.batch_count = ntohs(value_net);
+    offset += 2;
+    std::memcpy(&value_net, buffer + offset, 2);
+    report.track_count = ntohs(value_net);
+    offset += 2;
+    
+    // Validate size against the declared track count
+    size_t message_size = TrackReport::serializedSize(report.track_count);
+    if (report.track_count > max_tracks || buffer_size < message_size ||
+        report.batch_index >= report.batch_count) {
+        return false;
+    }
+    
+    // Validate checksum
+    uint16_t received_checksum;
+    std::memcpy(&received_checksum, buffer + 4, 2);
+    received_checksum = ntohs(received_checksum);
+    uint16_t calculated_checksum = calculateChecksum(buffer, 4);
+    calculated_checksum += calculateChecksum(buffer + 6, message_size - 6);
+    calculated_checksum &= 0xFFFF;
+    
+    if (calculated_checksum != received_checksum) {
+        return false;
+    }
+    
+    for (size_t i = 0; i < report.track_count; ++i) {
+        c2::Track& track = tracks[i];
+        uint32_t id_net;
+        std::memcpy(&id_net, buffer + offset, 4);
+        track.id = ntohl(id_net);
+        std::memcpy(&track.range_m, buffer + offset + 4, 8);
+        std::memcpy(&track.azimuth_rad, buffer + offset + 12, 8);
+        std::memcpy(&track.elevation_rad, buffer + offset + 20, 8);
+        std::memcpy(&track.velocity_ms, buffer + offset + 28, 8);
+        std::memcpy(&track.heading_rad, buffer + offset + 36, 8);
+        offset += TrackReport::TRACK_SIZE;
+    }
+    
+    return true;
+}
+
 } // namespace protocol
 } // namespace skyguardis
@@ -0,0 +1,235 @@
+#include "message_gateway/track_stream.hpp"
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+namespace skyguardis {
+namespace gateway {
+
+namespace {
+
+// Room for bursts of large cycles between C2 polls
+constexpr int TRACK_STREAM_SOCKET_BUFFER = 16 * 1024 * 1024;
+
+} // namespace
+
+TrackStreamSender::TrackStreamSender()
+    : socket_(-1), addr_(nullptr), initialized_(false), datagrams_sent_(0),
+      buffer_(protocol::TrackReport::MAX_SERIALIZED_SIZE) {
+    addr_ = new struct sockaddr_in;
+    std::memset(addr_, 0, sizeof(struct sockaddr_in));
+}
+
+TrackStreamSender::~TrackStreamSender() {
+    shutdown();
+    delete addr_;
+    addr_ = nullptr;
+}
+
+bool TrackStreamSender::initialize(uint16_t port, const char* host) {
+    if (initialized_) {
+        return true;
+    }
+    
+    socket_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socket_ < 0) {
+        return false;
+    }
+    
+    int buffer_size = TRACK_STREAM_SOCKET_BUFFER;
+    setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &buffer_size, sizeof(buffer_size));
+    
+    addr_->sin_family = AF_INET;
+    addr_->sin_addr.s_addr = inet_addr(host);
+    addr_->sin_port = htons(port);
+    
+    initialized_ = true;
+    return true;
+}
+
+bool TrackStreamSender::sendTracks(uint32_t cycle, c2::TrackSpan tracks) {
+    if (!initialized_) {
+        return false;
+    }
+    
+    const size_t max_tracks = protocol::TrackReport::MAX_TRACKS;
+    size_t batch_count = std::max<size_t>(1, (tracks.size() + max_tracks - 1) / max_tracks);
+    if (batch_count > UINT16_MAX) {
+        return false;
+    }
+    
+    bool ok = true;
+    for (size_t batch = 0; batch < batch_count; ++batch) {
+        size_t first = batch * max_tracks;
+        size_t count = std::min(max_tracks, tracks.size() - first);
+        
+        protocol::TrackReport report;
+        report.cycle = cycle;
+        report.batch_index = static_cast<uint16_t>(batch);
+        report.batch_count = static_cast<uint16_t>(batch_count);
+        report.track_count = static_cast<uint16_t>(count);
+        
+        size_t size = protocol::TrackReport::serializedSize(count);
+        if (!protocol::serializeTrackReport(report, tracks.data() + first, buffer_.data(), size)) {
+            return false;
+        }
+        
+        ssize_t sent = sendto(socket_, buffer_.data(), size, 0,
+                              (struct sockaddr*)addr_, sizeof(struct sockaddr_in));
+        if (sent == static_cast<ssize_t>(size)) {
+            datagrams_sent_++;
+        } else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void TrackStreamSender::shutdown() {
+    if (socket_ >= 0) {
+        close(socket_);
+        socket_ = -1;
+    }
+    initialized_ = false;
+}
+
+TrackStreamReceiver::TrackStreamReceiver()
+    : socket_(-1), initialized_(false), stats_{0, 0, 0},
+      datagram_(protocol::TrackReport::MAX_SERIALIZED_SIZE),
+      batch_tracks_(protocol::TrackReport::MAX_TRACKS),
+      assembling_(false), assembling_cycle_(0), assembling_batch_count_(0),
+      batches_remaining_(0), assembling_size_(0),
+      has_complete_(false), complete_cycle_(0) {}
+
+TrackStreamReceiver::~TrackStreamReceiver() {
+    shutdown();
+}
+
+bool TrackStreamReceiver::initialize(uint16_t port) {
+    if (initialized_) {
+        return true;
+    }
+    
+    socket_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socket_ < 0) {
+        return false;
+    }
+    
+    int buffer_size = TRACK_STREAM_SOCKET_BUFFER;
+    setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size));
+    
+    // Set socket to non-blocking
+    int flags = fcntl(socket_, F_GETFL, 0);
+    fcntl(socket_, F_SETFL, flags | O_NONBLOCK);
+    
+    struct sockaddr_in receive_addr;
+    std::memset(&receive_addr, 0, sizeof(receive_addr));
+    receive_addr.sin_family = AF_INET;
+    receive_addr.sin_addr.s_addr = INADDR_ANY;
+    receive_addr.sin_port = htons(port);
+    
+    if (bind(socket_, (struct sockaddr*)&receive_addr, sizeof(receive_addr)) < 0) {
+        close(socket_);
+        socket_ = -1;
+        return false;
+    }
+    
+    initialized_ = true;
+    return true;
+}
+
+bool TrackStreamReceiver::poll() {
+    if (!initialized_) {
+        return false;
+    }
+    
+    bool completed = false;
+    for (;;) {
+        ssize_t received = recv(socket_, datagram_.data(), datagram_.size(), 0);
+        if (received < 0) {
+            // EAGAIN/EWOULDBLOCK: drained (non-blocking)
+            break;
+        }
+        
+        protocol::TrackReport report;
+        if (!protocol::deserializeTrackReport(datagram_.data(), static_cast<size_t>(received), report,
+                                              batch_tracks_.data(), batch_tracks_.size())) {
+            stats_.reports_rejected++;
+            continue;
+        }
+        completed |= handleReport(report);
+    }
+    return completed;
+}
+
+bool TrackStreamReceiver::handleReport(const protocol::TrackReport& report) {
+    const size_t max_tracks = protocol::TrackReport::MAX_TRACKS;
+    
+    // Ignore cycles at or before the last complete one (wrap-safe)
+    if (has_complete_ && static_cast<int32_t>(report.cycle - complete_cycle_) <= 0) {
+        stats_.reports_rejected++;
+        return false;
+    }
+    
+    if (!assembling_ || report.cycle != assembling_cycle_) {
+        if (assembling_) {
+            if (static_cast<int32_t>(report.cycle - assembling_cycle_) < 0) {
+                stats_.reports_rejected++; // Older than the cycle in progress
+                return false;
+            }
+            stats_.cycles_dropped++;
+        }
+        assembling_ = true;
+        assembling_cycle_ = report.cycle;
+        assembling_batch_count_ = report.batch_count;
+        batches_remaining_ = report.batch_count;
+        assembling_size_ = static_cast<size_t>(report.batch_count - 1) * max_tracks;
+        batch_seen_.assign(report.batch_count, 0);
+        assembling_tracks_.resize(static_cast<size_t>(report.batch_count) * max_tracks);
+    }
+    
+    // Every batch but the last must be full
+    bool last = report.batch_index == assembling_batch_count_ - 1;
+    if (report.batch_count != assembling_batch_count_ ||
+        (!last && report.track_count != max_tracks) ||
+        batch_seen_[report.batch_index]) {
+        stats_.reports_rejected++;
+        return false;
+    }
+    
+    std::copy(batch_tracks_.begin(), batch_tracks_.begin() + report.track_count,
+              assembling_tracks_.begin() + static_cast<size_t>(report.batch_index) * max_tracks);
+    batch_seen_[report.batch_index] = 1;
+    if (last) {
+        assembling_size_ += report.track_count;
+    }
+    
+    if (--batches_remaining_ > 0) {
+        return false;
+    }
+    
+    // Publish; the old complete buffer becomes the next assembly buffer
+    assembling_tracks_.resize(assembling_size_);
+    complete_.swap(assembling_tracks_);
+    complete_cycle_ = assembling_cycle_;
+    has_complete_ = true;
+    assembling_ = false;
+    stats_.cycles_completed++;
+    return true;
+}
+
+void TrackStreamReceiver::shutdown() {
+    if (socket_ >= 0) {
+        close(socket_);
+        socket_ = -1;
+    }
+    initialized_ = false;
+}
+
+} // namespace gateway
+} // namespace skyguardis
@@ -0,0 +1,293 @@
+#include "radar_simulator/motion_kernels.hpp"
+#include "common/simd_trig.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace skyguardis {
+namespace radar {
+namespace motion {
+
+namespace {
+
+// Constants shared with the scalar motion model
+constexpr double MIN_VELOCITY_MS = 50.0;
+constexpr double MAX_VELOCITY_MS = 500.0;
+constexpr double MIN_SCALED_SPEED_MS = 1e-9; // Keeps a stationary track finite
+
+// Scalar kinematics on individual column entries
+inline void moveOne(double& east_m, double& north_m, double& up_m,
+                    double vel_east_ms, double vel_north_ms, double vel_up_ms,
+                    double delta_time_s) {
+    east_m += vel_east_ms * delta_time_s;
+    north_m += vel_north_ms * delta_time_s;
+    up_m += vel_up_ms * delta_time_s;
+}
+
+inline void maneuverOne(double& vel_east_ms, double& vel_north_ms, double& vel_up_ms,
+                        double acceleration_ms2, double angular_velocity_rads,
+                        double delta_time_s) {
+    const double speed = std::sqrt(vel_east_ms * vel_east_ms + vel_north_ms * vel_north_ms +
+                                   vel_up_ms * vel_up_ms);
+    const double new_speed = std::max(MIN_VELOCITY_MS, std::min(MAX_VELOCITY_MS,
+                                      speed + acceleration_ms2 * delta_time_s));
+    const double scale = new_speed / std::max(speed, MIN_SCALED_SPEED_MS);
+    
+    // Clockwise turn of the horizontal velocity (heading increases)
+    const double turn = angular_velocity_rads * delta_time_s;
+    const double cos_turn = std::cos(turn);
+    const double sin_turn = std::sin(turn);
+    const double east = vel_east_ms;
+    const double north = vel_north_ms;
+    vel_east_ms = (east * cos_turn + north * sin_turn) * scale;
+    vel_north_ms = (north * cos_turn - east * sin_turn) * scale;
+    vel_up_ms *= scale;
+}
+
+#ifdef SKYGUARDIS_X86_KERNELS
+
+// ---- AVX2 / FMA: 4 tracks per iteration ----
+
+// Lanes whose mask byte is zero (all-ones where the track must be left untouched)
+__attribute__((target("avx2,fma")))
+inline __m256d skipMask4(const uint8_t* mask, size_t index) {
+    uint32_t bytes;
+    std::memcpy(&bytes, mask + index, sizeof(bytes));
+    const __m256i wide = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(static_cast<int>(bytes)));
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(wide, _mm256_setzero_si256()));
+}
+
+__attribute__((target("avx2,fma")))
+size_t advanceLinearAvx2(double* east_m, double* north_m, double* up_m,
+                         const double* vel_east_ms, const double* vel_north_ms,
+                         const double* vel_up_ms,
+                         const uint8_t* mask, size_t count, double delta_time_s) {
+    const __m256d dt = _mm256_set1_pd(delta_time_s);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d east = _mm256_loadu_pd(east_m + i);
+        const __m256d north = _mm256_loadu_pd(north_m + i);
+        const __m256d up = _mm256_loadu_pd(up_m + i);
+
+        __m256d new_east = _mm256_fmadd_pd(_mm256_loadu_pd(vel_east_ms + i), dt, east);
+        __m256d new_north = _mm256_fmadd_pd(_mm256_loadu_pd(vel_north_ms + i), dt, north);
+        __m256d new_up = _mm256_fmadd_pd(_mm256_loadu_pd(vel_up_ms + i), dt, up);
+
+        if (mask) {
+            const __m256d skip = skipMask4(mask, i);
+            new_east = _mm256_blendv_pd(new_east, east, skip);
+            new_north = _mm256_blendv_pd(new_north, north, skip);
+            new_up = _mm256_blendv_pd(new_up, up, skip);
+        }
+
+        _mm256_storeu_pd(east_m + i, new_east);
+        _mm256_storeu_pd(north_m + i, new_north);
+        _mm256_storeu_pd(up_m + i, new_up);
+    }
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+size_t advanceManeuverAvx2(double* vel_east_ms, double* vel_north_ms, double* vel_up_ms,
+                           const double* acceleration_ms2, const double* angular_velocity_rads,
+                           const uint8_t* mask, size_t count, double delta_time_s) {
+    const __m256d dt = _mm256_set1_pd(delta_time_s);
+    const __m256d min_v = _mm256_set1_pd(MIN_VELOCITY_MS);
+    const __m256d max_v = _mm256_set1_pd(MAX_VELOCITY_MS);
+    const __m256d min_scaled = _mm256_set1_pd(MIN_SCALED_SPEED_MS);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d east = _mm256_loadu_pd(vel_east_ms + i);
+        const __m256d north = _mm256_loadu_pd(vel_north_ms + i);
+        const __m256d up = _mm256_loadu_pd(vel_up_ms + i);
+
+        const __m256d speed = _mm256_sqrt_pd(_mm256_fmadd_pd(east, east,
+                                  _mm256_fmadd_pd(north, north, _mm256_mul_pd(up, up))));
+        __m256d new_speed = _mm256_fmadd_pd(_mm256_loadu_pd(acceleration_ms2 + i), dt, speed);
+        new_speed = _mm256_max_pd(min_v, _mm256_min_pd(max_v, new_speed));
+        const __m256d scale = _mm256_div_pd(new_speed, _mm256_max_pd(speed, min_scaled));
+
+        __m256d sin_turn, cos_turn;
+        common::sincos4(_mm256_mul_pd(_mm256_loadu_pd(angular_velocity_rads + i), dt),
+                        sin_turn, cos_turn);
+
+        __m256d new_east = _mm256_mul_pd(_mm256_fmadd_pd(east, cos_turn,
+                                         _mm256_mul_pd(north, sin_turn)), scale);
+        __m256d new_north = _mm256_mul_pd(_mm256_fmsub_pd(north, cos_turn,
+                                          _mm256_mul_pd(east, sin_turn)), scale);
+        __m256d new_up = _mm256_mul_pd(up, scale);
+
+        if (mask) {
+            const __m256d skip = skipMask4(mask, i);
+            new_east = _mm256_blendv_pd(new_east, east, skip);
+            new_north = _mm256_blendv_pd(new_north, north, skip);
+            new_up = _mm256_blendv_pd(new_up, up, skip);
+        }
+
+        _mm256_storeu_pd(vel_east_ms + i, new_east);
+        _mm256_storeu_pd(vel_north_ms + i, new_north);
+        _mm256_storeu_pd(vel_up_ms + i, new_up);
+    }
+    return i;
+}
+
+// ---- SSE4.1: 2 tracks per iteration ----
+
+__attribute__((target("sse4.1")))
+inline __m128d skipMask2(const uint8_t* mask, size_t index) {
+    uint16_t bytes;
+    std::memcpy(&bytes, mask + index, sizeof(bytes));
+    const __m128i wide = _mm_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+    return _mm_castsi128_pd(_mm_cmpeq_epi64(wide, _mm_setzero_si128()));
+}
+
+__attribute__((target("sse4.1")))
+size_t advanceLinearSse41(double* east_m, double* north_m, double* up_m,
+                          const double* vel_east_ms, const double* vel_north_ms,
+                          const double* vel_up_ms,
+                          const uint8_t* mask, size_t count, double delta_time_s) {
+    const __m128d dt = _mm_set1_pd(delta_time_s);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d east = _mm_loadu_pd(east_m + i);
+        const __m128d north = _mm_loadu_pd(north_m + i);
+        const __m128d up = _mm_loadu_pd(up_m + i);
+
+        __m128d new_east = _mm_add_pd(east, _mm_mul_pd(_mm_loadu_pd(vel_east_ms + i), dt));
+        __m128d new_north = _mm_add_pd(north, _mm_mul_pd(_mm_loadu_pd(vel_north_ms + i), dt));
+        __m128d new_up = _mm_add_pd(up, _mm_mul_pd(_mm_loadu_pd(vel_up_ms + i), dt));
+
+        if (mask) {
+            const __m128d skip = skipMask2(mask, i);
+            new_east = _mm_blendv_pd(new_east, east, skip);
+            new_north = _mm_blendv_pd(new_north, north, skip);
+            new_up = _mm_blendv_pd(new_up, up, skip);
+        }
+
+        _mm_storeu_pd(east_m + i, new_east);
+        _mm_storeu_pd(north_m + i, new_north);
+        _mm_storeu_pd(up_m + i, new_up);
+    }
+    return i;
+}
+
+__attribute__((target("sse4.1")))
+size_t advanceManeuverSse41(double* vel_east_ms, double* vel_north_ms, double* vel_up_ms,
+                            const double* acceleration_ms2, const double* angular_velocity_rads,
+                            const uint8_t* mask, size_t count, double delta_time_s) {
+    const __m128d dt = _mm_set1_pd(delta_time_s);
+    const __m128d min_v = _mm_set1_pd(MIN_VELOCITY_MS);
+    const __m128d max_v = _mm_set1_pd(MAX_VELOCITY_MS);
+    const __m128d min_scaled = _mm_set1_pd(MIN_SCALED_SPEED_MS);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d east = _mm_loadu_pd(vel_east_ms + i);
+        const __m128d north = _mm_loadu_pd(vel_north_ms + i);
+        const __m128d up = _mm_loadu_pd(vel_up_ms + i);
+
+        const __m128d speed = _mm_sqrt_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(east, east),
+                                                                _mm_mul_pd(north, north)),
+                                                     _mm_mul_pd(up, up)));
+        __m128d new_speed = _mm_add_pd(speed, _mm_mul_pd(_mm_loadu_pd(acceleration_ms2 + i), dt));
+        new_speed = _mm_max_pd(min_v, _mm_min_pd(max_v, new_speed));
+        const __m128d scale = _mm_div_pd(new_speed, _mm_max_pd(speed, min_scaled));
+
+        __m128d sin_turn, cos_turn;
+        common::sincos2(_mm_mul_pd(_mm_loadu_pd(angular_velocity_rads + i), dt),
+                        sin_turn, cos_turn);
+
+        __m128d new_east = _mm_mul_pd(_mm_add_pd(_mm_mul_pd(east, cos_turn),
+                                                 _mm_mul_pd(north, sin_turn)), scale);
+        __m128d new_north = _mm_mul_pd(_mm_sub_pd(_mm_mul_pd(north, cos_turn),
+                                                  _mm_mul_pd(east, sin_turn)), scale);
+        __m128d new_up = _mm_mul_pd(up, scale);
+
+        if (mask) {
+            const __m128d skip = skipMask2(mask, i);
+            new_east = _mm_blendv_pd(new_east, east, skip);
+            new_north = _mm_blendv_pd(new_north, north, skip);
+            new_up = _mm_blendv_pd(new_up, up, skip);
+        }
+
+        _mm_storeu_pd(vel_east_ms + i, new_east);
+        _mm_storeu_pd(vel_north_ms + i, new_north);
+        _mm_storeu_pd(vel_up_ms + i, new_up);
+    }
+    return i;
+}
+
+#endif // SKYGUARDIS_X86_KERNELS
+
+} // namespace
+
+void advanceLinear(EnuState& state, double delta_time_s) {
+    moveOne(state.east_m, state.north_m, state.up_m,
+            state.vel_east_ms, state.vel_north_ms, state.vel_up_ms, delta_time_s);
+}
+
+void advanceManeuver(EnuState& state, double acceleration_ms2,
+                     double angular_velocity_rads, double delta_time_s) {
+    maneuverOne(state.vel_east_ms, state.vel_north_ms, state.vel_up_ms,
+                acceleration_ms2, angular_velocity_rads, delta_time_s);
+}
+
+void advanceLinearBatch(double* east_m, double* north_m, double* up_m,
+                        const double* vel_east_ms, const double* vel_north_ms,
+                        const double* vel_up_ms,
+                        const uint8_t* mask, size_t count, double delta_time_s) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = advanceLinearAvx2(east_m, north_m, up_m, vel_east_ms, vel_north_ms,
+                                     vel_up_ms, mask, count, delta_time_s);
+            break;
+        case common::KernelIsa::SSE41:
+            done = advanceLinearSse41(east_m, north_m, up_m, vel_east_ms, vel_north_ms,
+                                      vel_up_ms, mask, count, delta_time_s);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < count; ++i) {
+        if (mask && !mask[i]) continue;
+        moveOne(east_m[i], north_m[i], up_m[i],
+                vel_east_ms[i], vel_north_ms[i], vel_up_ms[i], delta_time_s);
+    }
+}
+
+void advanceManeuverBatch(double* vel_east_ms, double* vel_north_ms, double* vel_up_ms,
+                          const double* acceleration_ms2, const double* angular_velocity_rads,
+                          const uint8_t* mask, size_t count, double delta_time_s) {
+    size_t done = 0;
+#ifdef SKYGUARDIS_X86_KERNELS
+    switch (common::getKernelIsa()) {
+        case common::KernelIsa::AVX2:
+            done = advanceManeuverAvx2(vel_east_ms, vel_north_ms, vel_up_ms, acceleration_ms2,
+                                       angular_velocity_rads, mask, count, delta_time_s);
+            break;
+        case common::KernelIsa::SSE41:
+            done = advanceManeuverSse41(vel_east_ms, vel_north_ms, vel_up_ms, acceleration_ms2,
+                                        angular_velocity_rads, mask, count, delta_time_s);
+            break;
+        case common::KernelIsa::SCALAR:
+            break;
+    }
+#endif
+    // Scalar fallback and remainder
+    for (size_t i = done; i < count; ++i) {
+        if (mask && !mask[i]) continue;
+        maneuverOne(vel_east_ms[i], vel_north_ms[i], vel_up_ms[i],
+                    acceleration_ms2[i], angular_velocity_rads[i], delta_time_s);
+    }
+}
+
+} // namespace motion
+} // namespace radar
+} // namespace skyguardis
@@ -1,11 +1,12 @@
 #include "radar_simulator/radar_simulator.hpp"
-#include <algorithm>
-#include <chrono>
 
 namespace skyguardis {
 namespace radar {
 
-RadarSimulator::RadarSimulator() : initialized_(false) {
+RadarSimulator::RadarSimulator()
+    : clock_(&common::systemClock()), last_update_time_s_(0.0), cycle_count_(0),
+      initialized_(false), snapshot_front_(0), snapshot_generation_(0), snapshot_time_s_(0.0),
+      published_generation_(0), published_time_s_(0.0) {
     scenario_manager_ = std::make_unique<ScenarioManager>();
     initialize();
 }
@@ -14,16 +15,45 @@ RadarSimulator::~RadarSimulator() {}
 
 void RadarSimulator::initialize() {
     if (!initialized_) {
-        last_update_time_ = std::chrono::steady_clock::now();
+        last_update_time_s_ = clock_->now();
         scenario_manager_->setScenario(ScenarioType::SINGLE_TARGET);
         initialized_ = true;
     }
 }
 
 void RadarSimulator::setScenario(ScenarioType type, const ScenarioConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
     scenario_manager_->setScenario(type, config);
-    track_states_ = scenario_manager_->generateInitialTracks();
-    last_update_time_ = std::chrono::steady_clock::now();
+    scenario_manager_->generateInitialTracks(track_store_);
+    last_update_time_s_ = clock_->now();
+    publishSnapshot();
+}
+
+void RadarSimulator::setClock(common::Clock* clock) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    clock_ = clock ? clock : &common::systemClock();
+    scenario_manager_->setClock(clock_);
+    last_update_time_s_ = clock_->now();
+}
+
+void RadarSimulator::setWorkerCount(size_t worker_count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scenario_manager_->setWorkerCount(worker_count);
+}
+
+void RadarSimulator::setRandomSeed(uint64_t seed) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scenario_manager_->setRandomSeed(seed);
+}
+
+bool RadarSimulator::loadScript(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return scenario_manager_->loadScript(path);
+}
+
+std::string RadarSimulator::getScriptError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return scenario_manager_->getScript().getError();
 }
 
 ScenarioType RadarSimulator::getCurrentScenario() const {
@@ -31,51 +61,155 @@ ScenarioType RadarSimulator::getCurrentScenario() const {
 }
 
 void RadarSimulator::generateTracks() {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (!initialized_) {
         initialize();
     }
     
     // Generate initial tracks if empty
-    if (track_states_.empty()) {
-        track_states_ = scenario_manager_->generateInitialTracks();
+    if (track_store_.empty()) {
+        scenario_manager_->generateInitialTracks(track_store_);
+        publishSnapshot();
     }
 }
 
 void RadarSimulator::updateTracks(double delta_time_s) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (!initialized_) {
         initialize();
     }
     
     // Calculate actual delta time if not provided
+    double current_time = clock_->now();
     if (delta_time_s <= 0.0) {
-        auto current_time = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            current_time - last_update_time_);
-        delta_time_s = elapsed.count() / 1000.0;
-        last_update_time_ = current_time;
-    } else {
-        last_update_time_ = std::chrono::steady_clock::now();
+        delta_time_s = current_time - last_update_time_s_;
     }
+    last_update_time_s_ = current_time;
     
     // Update tracks using scenario manager
-    scenario_manager_->updateTracks(track_states_, delta_time_s);
+    scenario_manager_->updateTracks(track_store_, delta_time_s);
+    ++cycle_count_;
+    publishSnapshot();
+    
+    if (recorder_) {
+        recorder_->writeFrame(cycle_count_, current_time, track_store_);
+    }
+}
+
+bool RadarSimulator::startRecording(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto recorder = std::make_unique<TrackRecorder>();
+    if (!recorder->open(path)) {
+        return false;
+    }
+    recorder_ = std::move(recorder);
+    return true;
+}
+
+bool RadarSimulator::stopRecording() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!recorder_) {
+        return false;
+    }
+    bool ok = recorder_->close();
+    recorder_.reset();
+    return ok;
+}
+
+bool RadarSimulator::isRecording() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return recorder_ != nullptr;
 }
 
 std::vector<c2::Track> RadarSimulator::getCurrentTracks() const {
-    std::vector<c2::Track> tracks;
+    std::lock_guard<std::mutex> lock(mutex_);
+    refreshSnapshot();
+    const std::vector<c2::Track>& front = snapshot_buffers_[snapshot_front_];
+    return std::vector<c2::Track>(front.begin(), front.end());
+}
+
+TrackSnapshot RadarSimulator::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refreshSnapshot();
+    TrackSnapshot snapshot;
+    snapshot.tracks = c2::TrackSpan(snapshot_buffers_[snapshot_front_]);
+    snapshot.generation = snapshot_generation_;
+    snapshot.time_s = snapshot_time_s_;
+    return snapshot;
+}
+
+void RadarSimulator::publishSnapshot() {
+    // Conversion to spherical is deferred to the next reader
+    published_generation_++;
+    published_time_s_ = clock_->now();
+}
+
+void RadarSimulator::refreshSnapshot() const {
+    if (snapshot_generation_ == published_generation_) {
+        return;
+    }
     
-    for (const auto& track_state : track_states_) {
-        if (track_state.active) {
-            tracks.push_back(track_state.track);
+    // Gather active tracks into the back buffer, then flip
+    std::vector<c2::Track>& back = snapshot_buffers_[snapshot_front_ ^ 1];
+    back.resize(track_store_.activeCount());
+    size_t out = 0;
+    for (size_t i = 0; i < track_store_.size(); ++i) {
+        if (track_store_.active[i]) {
+            back[out++] = track_store_.track(i);
         }
     }
     
-    return tracks;
+    snapshot_front_ ^= 1;
+    snapshot_generation_ = published_generation_;
+    snapshot_time_s_ = published_time_s_;
+}
+
+void RadarSimulator::setMeasurementNoise(const MeasurementNoise& noise) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SensorConfig config = sensor_model_.getConfig();
+    config.noise = noise;
+    sensor_model_.setConfig(config);
+}
+
+void RadarSimulator::setSensorConfig(const SensorConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sensor_model_.setConfig(config);
+}
+
+SensorStats RadarSimulator::getSensorStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sensor_model_.getStats();
+}
+
+void RadarSimulator::getMeasurements(std::vector<c2::Measurement>& plots) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sensor_model_.scan(track_store_, scenario_manager_->getRandomSeed(), cycle_count_, plots);
+}
+
+void RadarSimulator::getMeasurements(SensorModel& sensor,
+                                     std::vector<c2::Measurement>& plots) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sensor.scan(track_store_, scenario_manager_->getRandomSeed(), cycle_count_, plots);
 }
 
 size_t RadarSimulator::getActiveTrackCount() const {
-    return std::count_if(track_states_.begin(), track_states_.end(),
-                         [](const TrackState& ts) { return ts.active; });
+    std::lock_guard<std::mutex> lock(mutex_);
+    return track_store_.activeCount();
+}
+
+bool RadarSimulator::findTrack(uint32_t track_id, c2::Track& track) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t index;
+    if (!track_store_.find(track_id, index) || !track_store_.active[index]) {
+        return false;
+    }
+    track = track_store_.track(index);
+    return true;
+}
+
+CycleStats RadarSimulator::getCycleStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return scenario_manager_->getCycleStats();
 }
 
 } // namespace radar
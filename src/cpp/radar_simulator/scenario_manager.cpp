@@ -1,14 +1,40 @@
 #include "radar_simulator/scenario_manager.hpp"
+#include "radar_simulator/motion_kernels.hpp"
 #include <random>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
+#include <functional>
 
 namespace skyguardis {
 namespace radar {
 
-ScenarioManager::ScenarioManager() : next_track_id_(1), scenario_start_time_s_(0.0) {
+namespace {
+
+// Maneuver changes: each maneuvering track draws one MANEUVER block per
+// cycle. Word 0 decides the change (5% chance), words 1 and 2 give the new
+// acceleration and turn rate.
+constexpr uint32_t MANEUVER_CHANGE_THRESHOLD = 214748365u;  // 0.05 * 2^32
+constexpr size_t MANEUVER_BATCH = 256;                       // Tracks per bulk draw
+constexpr double UNIT_32 = 1.0 / 4294967296.0;               // Scales 32 random bits to [0, 1)
+
+inline double maneuverAcceleration(uint32_t bits) {
+    return -50.0 + 100.0 * (bits * UNIT_32);
+}
+
+inline double maneuverTurnRate(uint32_t bits) {
+    return -0.5 + 1.0 * (bits * UNIT_32);
+}
+
+} // namespace
+
+ScenarioManager::ScenarioManager() : clock_(&common::systemClock()), next_track_id_(1), scenario_start_time_s_(0.0),
+                                     scenario_elapsed_s_(0.0), tracks_released_(0),
+                                     next_scripted_track_(0),
+                                     random_seed_(0), motion_cycle_(0),
+                                     sin_min_elevation_(0.0), sin_max_elevation_(0.0) {
     initializeRandomGenerator();
+    updateBoundsCache();
     scenario_start_time_s_ = getCurrentTime();
 }
 
@@ -16,13 +42,49 @@ ScenarioManager::~ScenarioManager() {}
 
 void ScenarioManager::initializeRandomGenerator() {
     std::random_device rd;
-    random_generator_.seed(rd());
+    setRandomSeed((static_cast<uint64_t>(rd()) << 32) | rd());
+}
+
+void ScenarioManager::setRandomSeed(uint64_t seed) {
+    random_seed_ = seed;
+    motion_cycle_ = 0;
+}
+
+void ScenarioManager::setWorkerCount(size_t worker_count) {
+    if (worker_count <= 1) {
+        worker_pool_.reset();
+    } else if (getWorkerCount() != worker_count) {
+        worker_pool_ = std::make_unique<WorkerPool>(worker_count - 1);
+    }
+}
+
+size_t ScenarioManager::getWorkerCount() const {
+    return worker_pool_ ? worker_pool_->threadCount() + 1 : 1;
+}
+
+void ScenarioManager::forEachBlock(size_t count,
+                                   const std::function<void(size_t, size_t, size_t)>& body) {
+    const size_t blocks = (count + UPDATE_BLOCK_SIZE - 1) / UPDATE_BLOCK_SIZE;
+    auto run_block = [&](size_t block) {
+        size_t begin = block * UPDATE_BLOCK_SIZE;
+        body(block, begin, std::min(begin + UPDATE_BLOCK_SIZE, count));
+    };
+    
+    if (worker_pool_) {
+        worker_pool_->parallelFor(blocks, run_block);
+    } else {
+        for (size_t block = 0; block < blocks; ++block) {
+            run_block(block);
+        }
+    }
 }
 
 double ScenarioManager::getCurrentTime() const {
-    auto now = std::chrono::steady_clock::now();
-    auto duration = now.time_since_epoch();
-    return std::chrono::duration<double>(duration).count();
+    return clock_->now();
+}
+
+void ScenarioManager::setClock(common::Clock* clock) {
+    clock_ = clock ? clock : &common::systemClock();
 }
 
 void ScenarioManager::setScenario(ScenarioType type, const ScenarioConfig& config) {
@@ -42,16 +104,68 @@ void ScenarioManager::setScenario(ScenarioType type, const ScenarioConfig& confi
             if (current_config_.target_count < 10) current_config_.target_count = 10;
             if (current_config_.target_count > 20) current_config_.target_count = 20;
             break;
+        case ScenarioType::MASS_RAID:
+            if (current_config_.target_count < MASS_RAID_MIN_TARGETS) {
+                current_config_.target_count = MASS_RAID_MIN_TARGETS;
+            }
+            if (current_config_.target_count > MASS_RAID_MAX_TARGETS) {
+                current_config_.target_count = MASS_RAID_MAX_TARGETS;
+            }
+            if (current_config_.wave_count < 1) current_config_.wave_count = 1;
+            if (current_config_.wave_count > current_config_.target_count) {
+                current_config_.wave_count = current_config_.target_count;
+            }
+            break;
+        case ScenarioType::SCRIPTED:
+            current_config_.target_count = static_cast<uint32_t>(script_.trackCount());
+            break;
     }
     
+    updateBoundsCache();
     scenario_start_time_s_ = getCurrentTime();
+    scenario_elapsed_s_ = 0.0;
+    tracks_released_ = 0;
+    next_scripted_track_ = 0;
+    motion_cycle_ = 0;
+    cycle_stats_ = CycleStats();
     next_track_id_ = 1;
 }
 
+void ScenarioManager::setConfig(const ScenarioConfig& config) {
+    current_config_ = config;
+    updateBoundsCache();
+}
+
+void ScenarioManager::updateBoundsCache() {
+    // Elevation limits as sines, so the Cartesian bounds test needs no asin.
+    // Limits beyond the zenith/nadir do not restrict anything.
+    const double half_pi = 1.57079632679489661923;
+    sin_min_elevation_ = std::sin(std::max(-half_pi, std::min(half_pi, current_config_.min_elevation_rad)));
+    sin_max_elevation_ = std::sin(std::max(-half_pi, std::min(half_pi, current_config_.max_elevation_rad)));
+}
+
+bool ScenarioManager::loadScript(const std::string& path) {
+    return script_.load(path);
+}
+
 std::vector<TrackState> ScenarioManager::generateInitialTracks() {
     std::vector<TrackState> tracks;
     
-    for (uint32_t i = 0; i < current_config_.target_count; ++i) {
+    if (current_config_.type == ScenarioType::SCRIPTED) {
+        addScriptedTracks(tracks, scriptedTracksDue());
+        return tracks;
+    }
+    
+    // Mass raids start with whatever the first wave releases at t = 0
+    const size_t initial_count = (current_config_.type == ScenarioType::MASS_RAID) ?
+                                 tracksDue() : current_config_.target_count;
+    tracks.reserve(initial_count);
+    if (current_config_.type == ScenarioType::MASS_RAID) {
+        tracks_released_ += initial_count;
+    }
+    cycle_stats_.tracks_spawned += initial_count;
+    
+    for (size_t i = 0; i < initial_count; ++i) {
         TrackState track = createRandomTrack(next_track_id_++);
         track.entry_time_s = getCurrentTime();
         track.last_update_time_s = track.entry_time_s;
@@ -61,37 +175,40 @@ std::vector<TrackState> ScenarioManager::generateInitialTracks() {
     return tracks;
 }
 
+void ScenarioManager::generateInitialTracks(TrackStore& store) {
+    store.clear();
+    store.reserve(current_config_.target_count);
+    
+    if (current_config_.type == ScenarioType::MASS_RAID) {
+        addNewTracks(store, tracksDue());
+    } else if (current_config_.type == ScenarioType::SCRIPTED) {
+        addScriptedTracks(store, scriptedTracksDue());
+    } else {
+        addNewTracks(store, current_config_.target_count);
+    }
+}
+
 TrackState ScenarioManager::createRandomTrack(uint32_t id) {
     TrackState track;
     track.track.id = id;
     
-    // Random position within bounds
-    std::uniform_real_distribution<double> range_dist(
-        current_config_.min_range_m, current_config_.max_range_m);
-    std::uniform_real_distribution<double> azimuth_dist(-3.14159, 3.14159);
-    std::uniform_real_distribution<double> elevation_dist(
-        current_config_.min_elevation_rad, current_config_.max_elevation_rad);
-    std::uniform_real_distribution<double> velocity_dist(
-        current_config_.min_velocity_ms, current_config_.max_velocity_ms);
-    std::uniform_real_distribution<double> heading_dist(-3.14159, 3.14159);
-    
-    track.track.range_m = range_dist(random_generator_);
-    track.track.azimuth_rad = azimuth_dist(random_generator_);
-    track.track.elevation_rad = elevation_dist(random_generator_);
-    track.track.velocity_ms = velocity_dist(random_generator_);
-    track.track.heading_rad = heading_dist(random_generator_);
+    // Random position within bounds (keyed by track id)
+    CounterRng rng(random_seed_, id, 0, CounterRng::Stream::TRACK_SPAWN);
+    track.track.range_m = rng.uniform(current_config_.min_range_m, current_config_.max_range_m);
+    track.track.azimuth_rad = rng.uniform(-3.14159, 3.14159);
+    track.track.elevation_rad = rng.uniform(current_config_.min_elevation_rad,
+                                            current_config_.max_elevation_rad);
+    track.track.velocity_ms = rng.uniform(current_config_.min_velocity_ms,
+                                          current_config_.max_velocity_ms);
+    track.track.heading_rad = rng.uniform(-3.14159, 3.14159);
     
     // Random motion model
-    std::uniform_int_distribution<int> model_dist(0, 1);
-    track.motion_model = (model_dist(random_generator_) == 0) ? 
-                        MotionModel::LINEAR : MotionModel::MANEUVERING;
+    track.motion_model = (rng.next() & 1u) == 0 ? MotionModel::LINEAR : MotionModel::MANEUVERING;
     
     // Set motion parameters
     if (track.motion_model == MotionModel::MANEUVERING) {
-        std::uniform_real_distribution<double> accel_dist(-50.0, 50.0);
-        std::uniform_real_distribution<double> angular_dist(-0.5, 0.5);
-        track.acceleration_ms2 = accel_dist(random_generator_);
-        track.angular_velocity_rads = angular_dist(random_generator_);
+        track.acceleration_ms2 = rng.uniform(-50.0, 50.0);
+        track.angular_velocity_rads = rng.uniform(-0.5, 0.5);
     } else {
         track.acceleration_ms2 = 0.0;
         track.angular_velocity_rads = 0.0;
@@ -104,7 +221,31 @@ TrackState ScenarioManager::createRandomTrack(uint32_t id) {
 }
 
 void ScenarioManager::updateTracks(std::vector<TrackState>& tracks, double delta_time_s) {
+    auto cycle_start = std::chrono::steady_clock::now();
     double current_time = getCurrentTime();
+    scenario_elapsed_s_ += delta_time_s;
+    
+    if (current_config_.type == ScenarioType::SCRIPTED) {
+        // Table playback; tracks leave at the end of their script
+        for (size_t i = tracks.size(); i-- > 0;) {
+            if (!playbackTrack(tracks[i])) {
+                if (i + 1 != tracks.size()) {
+                    tracks[i] = tracks.back();
+                }
+                tracks.pop_back();
+                continue;
+            }
+            if (tracks[i].active) {
+                tracks[i].history.push_back(tracks[i].track);
+                tracks[i].last_update_time_s = current_time;
+                tracks[i].age_cycles++;
+            }
+        }
+        ++motion_cycle_;
+        addScriptedTracks(tracks, scriptedTracksDue());
+        recordCycle(cycle_start, tracks.size());
+        return;
+    }
     
     // Update existing tracks
     for (auto& track : tracks) {
@@ -113,39 +254,154 @@ void ScenarioManager::updateTracks(std::vector<TrackState>& tracks, double delta
         // Apply motion model
         applyMotionModel(track, delta_time_s);
         
-        // Update history
-        if (track.history.size() >= TrackState::MAX_HISTORY) {
-            track.history.erase(track.history.begin());
-        }
+        // Update history (ring buffer drops the oldest entry when full)
         track.history.push_back(track.track);
         
         // Update metadata
         track.last_update_time_s = current_time;
         track.age_cycles++;
     }
+    ++motion_cycle_;
     
     // Remove out-of-bounds tracks
     removeOutOfBoundsTracks(tracks);
     
     // Add new tracks based on scenario type
+    if (current_config_.type == ScenarioType::MASS_RAID) {
+        size_t due = tracksDue();
+        for (size_t i = 0; i < due; ++i) {
+            addNewTrack(tracks, next_track_id_);
+        }
+        tracks_released_ += due;
+        cycle_stats_.tracks_spawned += due;
+    } else if (shouldSpawnTrack(tracks.size())) {
+        addNewTrack(tracks, next_track_id_);
+        cycle_stats_.tracks_spawned++;
+    }
+    
+    recordCycle(cycle_start, tracks.size());
+}
+
+void ScenarioManager::updateTracks(TrackStore& store, double delta_time_s) {
+    auto cycle_start = std::chrono::steady_clock::now();
+    double current_time = getCurrentTime();
+    scenario_elapsed_s_ += delta_time_s;
+    
+    // Motion, history, metadata and bounds flags, one block per task
+    const size_t count = store.size();
+    const size_t blocks = (count + UPDATE_BLOCK_SIZE - 1) / UPDATE_BLOCK_SIZE;
+    keep_mask_.resize(count);
+    block_removed_.assign(blocks, 0);
+    
+    const bool scripted = current_config_.type == ScenarioType::SCRIPTED;
+    const size_t maneuver_end = scripted ? 0 : partitionByMotionModel(store);
+    auto update_block = [&](size_t block, size_t begin, size_t end) {
+        if (scripted) {
+            playbackBlock(store, begin, end);
+        } else {
+            advanceBlock(store, begin, end, maneuver_end, delta_time_s);
+            for (size_t i = begin; i < end; ++i) {
+                keep_mask_[i] = isTrackInBounds(store, i) ? 1 : 0;
+            }
+        }
+        
+        uint8_t removed = 0;
+        for (size_t i = begin; i < end; ++i) {
+            if (store.active[i]) {
+                store.history[i].push_back(store.enu(i));
+                store.last_update_time_s[i] = current_time;
+                store.age_cycles[i]++;
+            }
+            removed |= !keep_mask_[i];
+        }
+        block_removed_[block] = removed;
+    };
+    // By reference: a std::function copy of this many captures would be
+    // heap-allocated every cycle
+    forEachBlock(count, std::cref(update_block));
+    ++motion_cycle_;
+    
+    // Merge: drop out-of-bounds tracks (serially, so the result does not
+    // depend on the worker count)
+    bool any_removed = false;
+    for (uint8_t removed : block_removed_) {
+        any_removed |= removed != 0;
+    }
+    if (any_removed) {
+        store.retain(keep_mask_);
+    }
+    
+    // Add new tracks based on scenario type
+    if (current_config_.type == ScenarioType::MASS_RAID) {
+        addNewTracks(store, tracksDue());
+    } else if (scripted) {
+        addScriptedTracks(store, scriptedTracksDue());
+    } else if (shouldSpawnTrack(store.size())) {
+        addNewTracks(store, 1);
+    }
+    
+    recordCycle(cycle_start, store.size());
+}
+
+void ScenarioManager::recordCycle(std::chrono::steady_clock::time_point start, size_t track_count) {
+    double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    
+    cycle_stats_.cycles++;
+    cycle_stats_.last_update_ms = elapsed_ms;
+    cycle_stats_.total_update_ms += elapsed_ms;
+    cycle_stats_.max_update_ms = std::max(cycle_stats_.max_update_ms, elapsed_ms);
+    cycle_stats_.last_track_count = track_count;
+}
+
+size_t ScenarioManager::tracksDue() const {
+    // target_count is split evenly across the waves (earlier waves take the
+    // remainder); wave i opens at i * wave_interval_s and then releases
+    // spawn_rate_per_s tracks per second until it is exhausted
+    const uint64_t total = current_config_.target_count;
+    const uint64_t waves = std::max<uint64_t>(1, current_config_.wave_count);
+    const uint64_t base = total / waves;
+    const uint64_t remainder = total % waves;
+    
+    uint64_t released = 0;
+    for (uint64_t wave = 0; wave < waves; ++wave) {
+        double open_s = wave * current_config_.wave_interval_s;
+        if (scenario_elapsed_s_ < open_s) break;
+        
+        uint64_t wave_size = base + (wave < remainder ? 1 : 0);
+        if (current_config_.spawn_rate_per_s > 0.0) {
+            // Small epsilon so accumulated cycle times land on whole tracks
+            double arrived = std::floor(
+                current_config_.spawn_rate_per_s * (scenario_elapsed_s_ - open_s) + 1e-6);
+            wave_size = std::min<uint64_t>(wave_size, static_cast<uint64_t>(arrived));
+        }
+        released += wave_size;
+    }
+    
+    return released > tracks_released_ ? static_cast<size_t>(released - tracks_released_) : 0;
+}
+
+bool ScenarioManager::shouldSpawnTrack(size_t track_count) {
     switch (current_config_.type) {
         case ScenarioType::SWARM:
         case ScenarioType::SATURATION:
             // Periodically add new tracks
-            if (tracks.size() < current_config_.target_count) {
-                std::uniform_real_distribution<double> add_prob(0.0, 1.0);
-                if (add_prob(random_generator_) < 0.1) { // 10% chance per cycle
-                    addNewTrack(tracks, next_track_id_);
-                }
+            if (track_count < current_config_.target_count) {
+                CounterRng rng(random_seed_, 0, motion_cycle_, CounterRng::Stream::SPAWN_DECISION);
+                return rng.uniform() < current_config_.spawn_probability;
             }
-            break;
+            return false;
+        case ScenarioType::MASS_RAID:
+            // Arrivals follow the wave schedule (see tracksDue)
+            return false;
+        case ScenarioType::SCRIPTED:
+            // Arrivals follow the script (see scriptedTracksDue)
+            return false;
         case ScenarioType::SINGLE_TARGET:
             // Only add if no tracks exist
-            if (tracks.empty()) {
-                addNewTrack(tracks, next_track_id_);
-            }
-            break;
+            return track_count == 0;
     }
+    return false;
 }
 
 void ScenarioManager::applyMotionModel(TrackState& track, double delta_time_s) {
@@ -160,51 +416,113 @@ void ScenarioManager::applyMotionModel(TrackState& track, double delta_time_s) {
 }
 
 void ScenarioManager::applyLinearMotion(TrackState& track, double delta_time_s) {
-    // Constant velocity motion
-    // Update position based on velocity and heading
-    double distance = track.track.velocity_ms * delta_time_s;
-    
-    // Convert spherical to Cartesian for motion, then back to spherical
-    // Simplified: update range and angles based on velocity direction
-    double range_change = distance * std::cos(track.track.elevation_rad) * 
-                         std::cos(track.track.heading_rad);
-    double azimuth_change = distance * std::cos(track.track.elevation_rad) * 
-                           std::sin(track.track.heading_rad) / track.track.range_m;
-    double elevation_change = -distance * std::sin(track.track.elevation_rad) / 
-                             track.track.range_m;
-    
-    track.track.range_m += range_change;
-    track.track.azimuth_rad += azimuth_change;
-    track.track.elevation_rad += elevation_change;
-    
-    // Normalize angles
-    while (track.track.azimuth_rad > 3.14159) track.track.azimuth_rad -= 2.0 * 3.14159;
-    while (track.track.azimuth_rad < -3.14159) track.track.azimuth_rad += 2.0 * 3.14159;
-    track.track.elevation_rad = std::max(-1.5708, std::min(1.5708, track.track.elevation_rad));
+    // Row path: propagate in Cartesian, then report back in spherical
+    EnuState state = common::toEnu(track.track);
+    motion::advanceLinear(state, delta_time_s);
+    common::toSpherical(state, track.track);
 }
 
 void ScenarioManager::applyManeuveringMotion(TrackState& track, double delta_time_s) {
-    // Velocity changes with acceleration
-    track.track.velocity_ms += track.acceleration_ms2 * delta_time_s;
-    
-    // Apply velocity constraints
-    track.track.velocity_ms = std::max(50.0, std::min(500.0, track.track.velocity_ms));
+    // Turn and accelerate, then move with the updated velocity
+    EnuState state = common::toEnu(track.track);
+    motion::advanceManeuver(state, track.acceleration_ms2, track.angular_velocity_rads,
+                            delta_time_s);
+    motion::advanceLinear(state, delta_time_s);
+    common::toSpherical(state, track.track);
     
-    // Update heading with angular velocity
-    track.track.heading_rad += track.angular_velocity_rads * delta_time_s;
-    while (track.track.heading_rad > 3.14159) track.track.heading_rad -= 2.0 * 3.14159;
-    while (track.track.heading_rad < -3.14159) track.track.heading_rad += 2.0 * 3.14159;
+    // Randomly change acceleration/angular velocity (simulate maneuvering)
+    maybeChangeManeuver(track.track.id, track.acceleration_ms2, track.angular_velocity_rads);
+}
+
+void ScenarioManager::applyMotionModel(TrackStore& store, double delta_time_s) {
+    const size_t maneuver_end = partitionByMotionModel(store);
+    auto advance = [&](size_t, size_t begin, size_t end) {
+        advanceBlock(store, begin, end, maneuver_end, delta_time_s);
+    };
+    forEachBlock(store.size(), std::cref(advance));
+    ++motion_cycle_;
+}
+
+size_t ScenarioManager::partitionByMotionModel(TrackStore& store) {
+    // Maneuvering rows to the front. Only rows spawned or moved by removals
+    // since the last cycle are out of place, so this is a scan of the model
+    // column plus a few row swaps. Returns the end of the maneuvering bucket.
+    size_t front = 0;
+    size_t back = store.size();
+    for (;;) {
+        while (front < back && store.motion_model[front] == MotionModel::MANEUVERING) {
+            ++front;
+        }
+        while (front < back && store.motion_model[back - 1] != MotionModel::MANEUVERING) {
+            --back;
+        }
+        if (front == back) {
+            return front;
+        }
+        store.swapRows(front++, --back);
+    }
+}
+
+void ScenarioManager::advanceBlock(TrackStore& store, size_t begin, size_t end,
+                                   size_t maneuver_end, double delta_time_s) {
+    // Rows [begin, split) belong to the maneuvering bucket
+    const size_t split = std::max(begin, std::min(end, maneuver_end));
     
-    // Apply linear motion with updated velocity
-    applyLinearMotion(track, delta_time_s);
+    // Batch kinematics: maneuvering tracks turn and accelerate first,
+    // then every active track moves along its velocity vector
+    if (split > begin) {
+        motion::advanceManeuverBatch(store.vel_east_ms.data() + begin, store.vel_north_ms.data() + begin,
+                                     store.vel_up_ms.data() + begin,
+                                     store.acceleration_ms2.data() + begin,
+                                     store.angular_velocity_rads.data() + begin,
+                                     store.active.data() + begin, split - begin, delta_time_s);
+    }
+    motion::advanceLinearBatch(store.east_m.data() + begin, store.north_m.data() + begin,
+                               store.up_m.data() + begin, store.vel_east_ms.data() + begin,
+                               store.vel_north_ms.data() + begin, store.vel_up_ms.data() + begin,
+                               store.active.data() + begin, end - begin, delta_time_s);
     
     // Randomly change acceleration/angular velocity (simulate maneuvering)
-    std::uniform_real_distribution<double> change_prob(0.0, 1.0);
-    if (change_prob(random_generator_) < 0.05) { // 5% chance per cycle
-        std::uniform_real_distribution<double> accel_dist(-50.0, 50.0);
-        std::uniform_real_distribution<double> angular_dist(-0.5, 0.5);
-        track.acceleration_ms2 = accel_dist(random_generator_);
-        track.angular_velocity_rads = angular_dist(random_generator_);
+    changeManeuvers(store, begin, split);
+}
+
+void ScenarioManager::changeManeuvers(TrackStore& store, size_t begin, size_t end) {
+    // Bulk draws: block 0 of every track's MANEUVER sequence, a batch of
+    // tracks at a time, then a select instead of a branch per track
+    const CounterRng::Key key = CounterRng::makeKey(random_seed_);
+    const CounterRng::Block counter = CounterRng::makeCounter(0, motion_cycle_,
+                                                              CounterRng::Stream::MANEUVER);
+    uint32_t lanes[4][MANEUVER_BATCH];
+    for (size_t base = begin; base < end; base += MANEUVER_BATCH) {
+        const size_t batch = std::min(MANEUVER_BATCH, end - base);
+        for (size_t i = 0; i < batch; ++i) {
+            lanes[0][i] = counter[0];
+            lanes[1][i] = store.id[base + i];
+            lanes[2][i] = counter[2];
+            lanes[3][i] = counter[3];
+        }
+        CounterRng::philoxLanes(lanes, batch, key);
+        
+        const uint8_t* active = store.active.data() + base;
+        double* acceleration = store.acceleration_ms2.data() + base;
+        double* turn_rate = store.angular_velocity_rads.data() + base;
+        for (size_t i = 0; i < batch; ++i) {
+            const bool change = active[i] && lanes[0][i] < MANEUVER_CHANGE_THRESHOLD;
+            acceleration[i] = change ? maneuverAcceleration(lanes[1][i]) : acceleration[i];
+            turn_rate[i] = change ? maneuverTurnRate(lanes[2][i]) : turn_rate[i];
+        }
+    }
+}
+
+void ScenarioManager::maybeChangeManeuver(uint32_t track_id, double& acceleration_ms2,
+                                          double& angular_velocity_rads) {
+    // Same draw as changeManeuvers, for one track
+    const CounterRng::Block draw = CounterRng::philox(
+        CounterRng::makeCounter(track_id, motion_cycle_, CounterRng::Stream::MANEUVER),
+        CounterRng::makeKey(random_seed_));
+    if (draw[0] < MANEUVER_CHANGE_THRESHOLD) {
+        acceleration_ms2 = maneuverAcceleration(draw[1]);
+        angular_velocity_rads = maneuverTurnRate(draw[2]);
     }
 }
 
@@ -215,25 +533,152 @@ void ScenarioManager::addNewTrack(std::vector<TrackState>& tracks, uint32_t& nex
     tracks.push_back(new_track);
 }
 
+void ScenarioManager::addNewTrack(TrackStore& store, uint32_t& next_id) {
+    TrackState new_track = createRandomTrack(next_id++);
+    new_track.entry_time_s = getCurrentTime();
+    new_track.last_update_time_s = new_track.entry_time_s;
+    store.push_back(new_track);
+}
+
+void ScenarioManager::addNewTracks(TrackStore& store, size_t count) {
+    if (count == 0) return;
+    
+    // One timestamp for the whole batch
+    double entry_time = getCurrentTime();
+    for (size_t i = 0; i < count; ++i) {
+        TrackState new_track = createRandomTrack(next_track_id_++);
+        new_track.entry_time_s = entry_time;
+        new_track.last_update_time_s = entry_time;
+        store.push_back(new_track);
+    }
+    
+    if (current_config_.type == ScenarioType::MASS_RAID) {
+        tracks_released_ += count;
+    }
+    cycle_stats_.tracks_spawned += count;
+}
+
+size_t ScenarioManager::scriptedTracksDue() const {
+    // Script tracks are sorted by spawn time; small epsilon so accumulated
+    // cycle times land on the scheduled spawn
+    size_t due = 0;
+    while (next_scripted_track_ + due < script_.trackCount() &&
+           script_.track(next_scripted_track_ + due).spawn_time_s <= scenario_elapsed_s_ + 1e-6) {
+        ++due;
+    }
+    return due;
+}
+
+TrackState ScenarioManager::createScriptedTrack(size_t script_index, EnuState& state) {
+    const ScriptedTrack& scripted = script_.track(script_index);
+    TrackState track;
+    track.track.id = scripted.track_id;
+    track.motion_model = MotionModel::LINEAR;
+    track.trajectory = static_cast<uint32_t>(script_index);
+    script_.sample(scripted, scenario_elapsed_s_ - scripted.spawn_time_s, track.trajectory_leg, state);
+    common::toSpherical(state, track.track);
+    track.active = isTrackInBounds(track);
+    track.entry_time_s = getCurrentTime();
+    track.last_update_time_s = track.entry_time_s;
+    return track;
+}
+
+void ScenarioManager::addScriptedTracks(std::vector<TrackState>& tracks, size_t count) {
+    EnuState state;
+    for (size_t i = 0; i < count; ++i) {
+        tracks.push_back(createScriptedTrack(next_scripted_track_++, state));
+    }
+    cycle_stats_.tracks_spawned += count;
+}
+
+void ScenarioManager::addScriptedTracks(TrackStore& store, size_t count) {
+    EnuState state;
+    for (size_t i = 0; i < count; ++i) {
+        TrackState track = createScriptedTrack(next_scripted_track_++, state);
+        store.push_back(track);
+        store.setEnu(store.size() - 1, state); // Keep the vertical velocity
+    }
+    cycle_stats_.tracks_spawned += count;
+}
+
+bool ScenarioManager::playbackTrack(TrackState& track) {
+    const ScriptedTrack& scripted = script_.track(track.trajectory);
+    EnuState state;
+    bool running = script_.sample(scripted, scenario_elapsed_s_ - scripted.spawn_time_s,
+                                  track.trajectory_leg, state);
+    common::toSpherical(state, track.track);
+    track.active = isTrackInBounds(track);
+    return running;
+}
+
+void ScenarioManager::playbackBlock(TrackStore& store, size_t begin, size_t end) {
+    // Table lookup per track: position on the current leg, no integration
+    for (size_t i = begin; i < end; ++i) {
+        const ScriptedTrack& scripted = script_.track(store.trajectory[i]);
+        EnuState state;
+        bool running = script_.sample(scripted, scenario_elapsed_s_ - scripted.spawn_time_s,
+                                      store.trajectory_leg[i], state);
+        store.setEnu(i, state);
+        store.active[i] = isTrackInBounds(store, i) ? 1 : 0;
+        keep_mask_[i] = running ? 1 : 0;
+    }
+}
+
 void ScenarioManager::removeOutOfBoundsTracks(std::vector<TrackState>& tracks) {
-    tracks.erase(
-        std::remove_if(tracks.begin(), tracks.end(),
-            [this](const TrackState& track) {
-                return !isTrackInBounds(track);
-            }),
-        tracks.end()
-    );
+    // Swap-and-pop: only the removed tracks and their replacements move
+    for (size_t i = tracks.size(); i-- > 0;) {
+        if (!isTrackInBounds(tracks[i])) {
+            if (i + 1 != tracks.size()) {
+                tracks[i] = tracks.back();
+            }
+            tracks.pop_back();
+        }
+    }
+}
+
+void ScenarioManager::removeOutOfBoundsTracks(TrackStore& store) {
+    const size_t count = store.size();
+    keep_mask_.resize(count);
+    bool any_removed = false;
+    for (size_t i = 0; i < count; ++i) {
+        keep_mask_[i] = isTrackInBounds(store, i) ? 1 : 0;
+        any_removed |= !keep_mask_[i];
+    }
+    
+    if (any_removed) {
+        store.retain(keep_mask_);
+    }
 }
 
 bool ScenarioManager::isTrackInBounds(const TrackState& track) const {
+    return isInBounds(track.track.range_m, track.track.elevation_rad);
+}
+
+bool ScenarioManager::isTrackInBounds(const TrackStore& store, size_t index) const {
+    // Same test as isInBounds, on the Cartesian columns:
+    // elevation in [min, max] <=> up in [range * sin(min), range * sin(max)]
+    const double east = store.east_m[index];
+    const double north = store.north_m[index];
+    const double up = store.up_m[index];
+    const double range_m = std::sqrt(east * east + north * north + up * up);
+    
+    if (range_m < current_config_.min_range_m ||
+        range_m > current_config_.detection_zone_radius_m) {
+        return false;
+    }
+    
+    return up >= range_m * sin_min_elevation_ && up <= range_m * sin_max_elevation_;
+}
+
+bool ScenarioManager::isInBounds(double range_m, double elevation_rad) const {
     // Check if track is within detection zone
-    if (track.track.range_m < current_config_.min_range_m ||
-        track.track.range_m > current_config_.detection_zone_radius_m) {
+    if (range_m < current_config_.min_range_m ||
+        range_m > current_config_.detection_zone_radius_m) {
         return false;
     }
     
-    if (track.track.elevation_rad < current_config_.min_elevation_rad ||
-        track.track.elevation_rad > current_config_.max_elevation_rad) {
+    if (elevation_rad < current_config_.min_elevation_rad ||
+        elevation_rad > current_config_.max_elevation_rad) {
         return false;
     }
     
@@ -242,4 +687,3 @@ bool ScenarioManager::isTrackInBounds(const TrackState& track) const {
 
 } // namespace radar
 } // namespace skyguardis
-
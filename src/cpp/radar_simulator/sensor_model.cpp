@@ -0,0 +1,118 @@
+#include "radar_simulator/sensor_model.hpp"
+#include "radar_simulator/counter_rng.hpp"
+#include "radar_simulator/motion_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace skyguardis {
+namespace radar {
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+constexpr double UNIT_32 = 1.0 / 4294967296.0;  // Scales 32 random bits to [0, 1)
+
+} // namespace
+
+SensorModel::SensorModel() {}
+
+SensorModel::SensorModel(const SensorConfig& config) : config_(config) {}
+
+void SensorModel::setConfig(const SensorConfig& config) {
+    config_ = config;
+}
+
+size_t SensorModel::poissonCount(uint64_t seed, uint64_t cycle, double mean) {
+    if (!(mean > 0.0)) {
+        return 0;
+    }
+    CounterRng rng(seed, 0, cycle, CounterRng::Stream::CLUTTER_COUNT);
+    if (mean < 64.0) {
+        // Multiply uniforms until the product drops below e^-mean
+        const double limit = std::exp(-mean);
+        size_t count = 0;
+        double product = rng.uniform();
+        while (product > limit) {
+            ++count;
+            product *= rng.uniform();
+        }
+        return count;
+    }
+    const double count = std::floor(mean + std::sqrt(mean) * rng.gaussian() + 0.5);
+    return count > 0.0 ? static_cast<size_t>(count) : 0;
+}
+
+void SensorModel::scan(const TrackStore& store, uint64_t seed, uint64_t cycle,
+                       std::vector<c2::Measurement>& plots) {
+    stats_ = SensorStats();
+    seed ^= config_.sensor_id * 0x9E3779B97F4A7C15ull;
+    const size_t clutter = poissonCount(seed, cycle, config_.false_alarms_per_scan);
+    plots.resize(store.activeCount() + clutter);
+
+    // Detections: noise first, then the detection draw, so Pd = 1 gives
+    // the same plots whatever the clutter
+    const MeasurementNoise& noise = config_.noise;
+    const bool always_detect = config_.detection_probability >= 1.0;
+    size_t out = 0;
+    for (size_t i = 0; i < store.size(); ++i) {
+        if (!store.active[i]) {
+            continue;
+        }
+        EnuState relative = store.enu(i);
+        relative.east_m -= config_.site_east_m;
+        relative.north_m -= config_.site_north_m;
+        relative.up_m -= config_.site_up_m;
+        c2::Track truth;
+        common::toSpherical(relative, truth);
+        truth.id = store.id[i];
+        CounterRng rng(seed, truth.id, cycle, CounterRng::Stream::MEASUREMENT);
+        c2::Measurement& plot = plots[out];
+        plot.track_id = truth.id;
+        plot.range_m = truth.range_m + noise.range_sigma_m * rng.gaussian();
+        plot.azimuth_rad = truth.azimuth_rad + noise.azimuth_sigma_rad * rng.gaussian();
+        plot.elevation_rad = truth.elevation_rad + noise.elevation_sigma_rad * rng.gaussian();
+        if (always_detect || rng.uniform() < config_.detection_probability) {
+            ++out;
+        } else {
+            stats_.missed++;
+        }
+    }
+    stats_.detections = out;
+
+    generateClutter(seed, cycle, plots.data() + out, clutter);
+    stats_.false_alarms = clutter;
+    plots.resize(out + clutter);
+}
+
+void SensorModel::generateClutter(uint64_t seed, uint64_t cycle, c2::Measurement* out,
+                                  size_t count) {
+    const CounterRng::Key key = CounterRng::makeKey(seed);
+    const CounterRng::Block counter = CounterRng::makeCounter(0, cycle, CounterRng::Stream::CLUTTER);
+    const double range_low = config_.clutter_min_range_m;
+    const double range_span = config_.clutter_max_range_m - range_low;
+    const double elevation_low = config_.clutter_min_elevation_rad;
+    const double elevation_span = config_.clutter_max_elevation_rad - elevation_low;
+
+    // False alarm n uses block 0 of the CLUTTER sequence keyed by id n
+    uint32_t lanes[4][CLUTTER_BATCH];
+    for (size_t base = 0; base < count; base += CLUTTER_BATCH) {
+        const size_t batch = std::min(CLUTTER_BATCH, count - base);
+        for (size_t i = 0; i < batch; ++i) {
+            lanes[0][i] = counter[0];
+            lanes[1][i] = static_cast<uint32_t>(base + i);
+            lanes[2][i] = counter[2];
+            lanes[3][i] = counter[3];
+        }
+        CounterRng::philoxLanes(lanes, batch, key);
+        for (size_t i = 0; i < batch; ++i) {
+            c2::Measurement& plot = out[base + i];
+            plot.track_id = c2::FALSE_ALARM_ID;
+            plot.range_m = range_low + range_span * (lanes[0][i] * UNIT_32);
+            plot.azimuth_rad = TWO_PI * (lanes[1][i] * UNIT_32) - TWO_PI / 2.0;
+            plot.elevation_rad = elevation_low + elevation_span * (lanes[2][i] * UNIT_32);
+        }
+    }
+}
+
+} // namespace radar
+} // namespace skyguardis
@@ -0,0 +1,75 @@
+#include "radar_simulator/sensor_network.hpp"
+#include "radar_simulator/radar_simulator.hpp"
+#include <algorithm>
+
+namespace skyguardis {
+namespace radar {
+
+namespace {
+
+constexpr double SCHEDULE_SLACK_S = 1e-9;  // Absorbs rounding in accumulated periods
+
+} // namespace
+
+uint32_t SensorNetwork::addSensor(const SensorSpec& spec) {
+    const uint32_t sensor = static_cast<uint32_t>(specs_.size());
+    specs_.push_back(spec);
+    specs_.back().sensor.sensor_id = sensor;
+    models_.emplace_back(specs_.back().sensor);
+    next_scan_s_.push_back(0.0);
+    started_.push_back(0);
+    return sensor;
+}
+
+void SensorNetwork::clear() {
+    specs_.clear();
+    models_.clear();
+    next_scan_s_.clear();
+    started_.clear();
+    pending_.clear();
+}
+
+void SensorNetwork::scan(const RadarSimulator& radar, double time_s) {
+    for (uint32_t sensor = 0; sensor < specs_.size(); ++sensor) {
+        // The first call starts every sensor's schedule
+        if (!started_[sensor]) {
+            next_scan_s_[sensor] = time_s;
+            started_[sensor] = 1;
+        }
+        if (time_s + SCHEDULE_SLACK_S < next_scan_s_[sensor]) {
+            continue;
+        }
+        pending_.emplace_back();
+        SensorReport& report = pending_.back();
+        report.sensor = sensor;
+        report.time_s = time_s;
+        radar.getMeasurements(models_[sensor], report.plots);
+
+        // Skip scans missed by a coarse caller rather than bunching them
+        const double period = std::max(specs_[sensor].scan_period_s, SCHEDULE_SLACK_S);
+        while (next_scan_s_[sensor] <= time_s + SCHEDULE_SLACK_S) {
+            next_scan_s_[sensor] += period;
+        }
+    }
+}
+
+void SensorNetwork::collect(double time_s, std::vector<SensorReport>& reports) {
+    reports.clear();
+    size_t kept = 0;
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        if (pending_[i].time_s + specs_[pending_[i].sensor].latency_s <= time_s + SCHEDULE_SLACK_S) {
+            reports.push_back(std::move(pending_[i]));
+        } else {
+            if (kept != i) {
+                pending_[kept] = std::move(pending_[i]);
+            }
+            ++kept;
+        }
+    }
+    pending_.resize(kept);
+    std::stable_sort(reports.begin(), reports.end(),
+                     [](const SensorReport& a, const SensorReport& b) { return a.time_s < b.time_s; });
+}
+
+} // namespace radar
+} // namespace skyguardis
@@ -0,0 +1,210 @@
+#include "radar_simulator/track_recording.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace skyguardis {
+namespace radar {
+
+TrackRecorder::TrackRecorder() : write_offset_(0) {}
+
+TrackRecorder::~TrackRecorder() {
+    if (isOpen()) {
+        close();
+    }
+}
+
+bool TrackRecorder::open(const std::string& path) {
+    if (isOpen()) {
+        close();
+    }
+    
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        return false;
+    }
+    
+    // Placeholder header, completed by close()
+    recording::RecordingHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, recording::MAGIC, sizeof(header.magic));
+    header.version = recording::VERSION;
+    header.track_record_size = sizeof(c2::Track);
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    
+    frame_offsets_.clear();
+    write_offset_ = sizeof(header);
+    return file_.good();
+}
+
+bool TrackRecorder::writeFrame(uint64_t cycle, double time_s, const std::vector<c2::Track>& tracks) {
+    // Copy through the staging buffer so padding bytes in the file are zero
+    staging_.resize(tracks.size());
+    std::memset(static_cast<void*>(staging_.data()), 0, staging_.size() * sizeof(c2::Track));
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        c2::Track& out = staging_[i];
+        out.id = tracks[i].id;
+        out.range_m = tracks[i].range_m;
+        out.azimuth_rad = tracks[i].azimuth_rad;
+        out.elevation_rad = tracks[i].elevation_rad;
+        out.velocity_ms = tracks[i].velocity_ms;
+        out.heading_rad = tracks[i].heading_rad;
+    }
+    return writeFrame(cycle, time_s, staging_.data(), staging_.size());
+}
+
+bool TrackRecorder::writeFrame(uint64_t cycle, double time_s, const TrackStore& store) {
+    staging_.resize(store.activeCount());
+    std::memset(static_cast<void*>(staging_.data()), 0, staging_.size() * sizeof(c2::Track));
+    size_t out_index = 0;
+    for (size_t i = 0; i < store.size(); ++i) {
+        if (!store.active[i]) continue;
+        const c2::Track track = store.track(i);
+        c2::Track& out = staging_[out_index++];
+        out.id = track.id;
+        out.range_m = track.range_m;
+        out.azimuth_rad = track.azimuth_rad;
+        out.elevation_rad = track.elevation_rad;
+        out.velocity_ms = track.velocity_ms;
+        out.heading_rad = track.heading_rad;
+    }
+    return writeFrame(cycle, time_s, staging_.data(), staging_.size());
+}
+
+bool TrackRecorder::writeFrame(uint64_t cycle, double time_s, const c2::Track* tracks, size_t count) {
+    if (!isOpen()) {
+        return false;
+    }
+    
+    recording::FrameHeader frame;
+    std::memset(&frame, 0, sizeof(frame));
+    frame.cycle = cycle;
+    frame.time_s = time_s;
+    frame.track_count = static_cast<uint32_t>(count);
+    
+    file_.write(reinterpret_cast<const char*>(&frame), sizeof(frame));
+    file_.write(reinterpret_cast<const char*>(tracks), count * sizeof(c2::Track));
+    
+    frame_offsets_.push_back(write_offset_);
+    write_offset_ += sizeof(frame) + count * sizeof(c2::Track);
+    return file_.good();
+}
+
+bool TrackRecorder::close() {
+    if (!isOpen()) {
+        return false;
+    }
+    
+    // Index after the last frame, then patch the header
+    file_.write(reinterpret_cast<const char*>(frame_offsets_.data()),
+                frame_offsets_.size() * sizeof(uint64_t));
+    
+    recording::RecordingHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, recording::MAGIC, sizeof(header.magic));
+    header.version = recording::VERSION;
+    header.track_record_size = sizeof(c2::Track);
+    header.frame_count = frame_offsets_.size();
+    header.index_offset = write_offset_;
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    
+    bool ok = file_.good();
+    file_.close();
+    return ok;
+}
+
+TrackReplay::TrackReplay() : data_(nullptr), size_(0), index_(nullptr), frame_count_(0) {}
+
+TrackReplay::~TrackReplay() {
+    close();
+}
+
+bool TrackReplay::open(const std::string& path) {
+    close();
+    
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(recording::RecordingHeader)) {
+        ::close(fd);
+        return false;
+    }
+    
+    size_t size = static_cast<size_t>(info.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    data_ = static_cast<const uint8_t*>(mapped);
+    size_ = size;
+    
+    // Validate header, index and every frame extent up front so frame()
+    // never has to
+    const auto* header = reinterpret_cast<const recording::RecordingHeader*>(data_);
+    bool valid = std::memcmp(header->magic, recording::MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == recording::VERSION &&
+                 header->track_record_size == sizeof(c2::Track) &&
+                 header->index_offset >= sizeof(recording::RecordingHeader) &&
+                 header->index_offset % 8 == 0 &&
+                 header->index_offset <= size_ &&
+                 header->frame_count <= (size_ - header->index_offset) / sizeof(uint64_t);
+    
+    if (valid) {
+        index_ = reinterpret_cast<const uint64_t*>(data_ + header->index_offset);
+        frame_count_ = header->frame_count;
+        for (size_t i = 0; i < frame_count_ && valid; ++i) {
+            uint64_t offset = index_[i];
+            valid = offset % 8 == 0 &&
+                    offset <= header->index_offset - sizeof(recording::FrameHeader);
+            if (valid) {
+                const auto* frame = reinterpret_cast<const recording::FrameHeader*>(data_ + offset);
+                valid = frame->track_count <=
+                        (header->index_offset - offset - sizeof(recording::FrameHeader)) / sizeof(c2::Track);
+            }
+        }
+    }
+    
+    if (!valid) {
+        close();
+        return false;
+    }
+    
+    // Frames are read front to back
+    madvise(mapped, size_, MADV_SEQUENTIAL);
+    return true;
+}
+
+void TrackReplay::close() {
+    if (data_) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    index_ = nullptr;
+    frame_count_ = 0;
+}
+
+FrameView TrackReplay::frame(size_t index) const {
+    FrameView view{0, 0.0, nullptr, 0};
+    if (index >= frame_count_) {
+        return view;
+    }
+    
+    const uint8_t* base = data_ + index_[index];
+    const auto* header = reinterpret_cast<const recording::FrameHeader*>(base);
+    view.cycle = header->cycle;
+    view.time_s = header->time_s;
+    view.tracks = reinterpret_cast<const c2::Track*>(base + sizeof(recording::FrameHeader));
+    view.count = header->track_count;
+    return view;
+}
+
+} // namespace radar
+} // namespace skyguardis
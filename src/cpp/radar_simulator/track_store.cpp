@@ -0,0 +1,284 @@
+#include "radar_simulator/track_store.hpp"
+#include "radar_simulator/motion_kernels.hpp"
+#include <algorithm>
+
+namespace skyguardis {
+namespace radar {
+
+namespace {
+
+template <typename T>
+void swapPop(std::vector<T>& column, size_t index) {
+    if (index + 1 != column.size()) {
+        column[index] = column.back();
+    }
+    column.pop_back();
+}
+
+} // namespace
+
+void TrackStore::reserve(size_t capacity) {
+    id.reserve(capacity);
+    east_m.reserve(capacity);
+    north_m.reserve(capacity);
+    up_m.reserve(capacity);
+    vel_east_ms.reserve(capacity);
+    vel_north_ms.reserve(capacity);
+    vel_up_ms.reserve(capacity);
+    motion_model.reserve(capacity);
+    acceleration_ms2.reserve(capacity);
+    angular_velocity_rads.reserve(capacity);
+    active.reserve(capacity);
+    age_cycles.reserve(capacity);
+    last_update_time_s.reserve(capacity);
+    entry_time_s.reserve(capacity);
+    trajectory.reserve(capacity);
+    trajectory_leg.reserve(capacity);
+    history.reserve(capacity);
+    slot.reserve(capacity);
+    slot_row_.reserve(capacity);
+    slot_generation_.reserve(capacity);
+    id_slot_.reserve(capacity);
+    free_slots_.reserve(capacity);
+}
+
+void TrackStore::clear() {
+    id.clear();
+    east_m.clear();
+    north_m.clear();
+    up_m.clear();
+    vel_east_ms.clear();
+    vel_north_ms.clear();
+    vel_up_ms.clear();
+    motion_model.clear();
+    acceleration_ms2.clear();
+    angular_velocity_rads.clear();
+    active.clear();
+    age_cycles.clear();
+    last_update_time_s.clear();
+    entry_time_s.clear();
+    trajectory.clear();
+    trajectory_leg.clear();
+    history.clear();
+    slot.clear();
+    
+    // Every outstanding handle becomes stale
+    free_slots_.clear();
+    for (uint32_t s = static_cast<uint32_t>(slot_row_.size()); s-- > 0;) {
+        slot_generation_[s]++;
+        free_slots_.push_back(s);
+    }
+    id_slot_.clear();
+}
+
+TrackHandle TrackStore::push_back(const TrackState& state) {
+    const EnuState kinematics = common::toEnu(state.track);
+    id.push_back(state.track.id);
+    east_m.push_back(kinematics.east_m);
+    north_m.push_back(kinematics.north_m);
+    up_m.push_back(kinematics.up_m);
+    vel_east_ms.push_back(kinematics.vel_east_ms);
+    vel_north_ms.push_back(kinematics.vel_north_ms);
+    vel_up_ms.push_back(kinematics.vel_up_ms);
+    motion_model.push_back(state.motion_model);
+    acceleration_ms2.push_back(state.acceleration_ms2);
+    angular_velocity_rads.push_back(state.angular_velocity_rads);
+    active.push_back(state.active ? 1 : 0);
+    age_cycles.push_back(state.age_cycles);
+    last_update_time_s.push_back(state.last_update_time_s);
+    entry_time_s.push_back(state.entry_time_s);
+    trajectory.push_back(state.trajectory);
+    trajectory_leg.push_back(state.trajectory_leg);
+    history.emplace_back();
+    for (const c2::Track& entry : state.history) {
+        history.back().push_back(common::toEnu(entry));
+    }
+    
+    // Reuse a freed slot if there is one
+    uint32_t new_slot;
+    if (!free_slots_.empty()) {
+        new_slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        new_slot = static_cast<uint32_t>(slot_row_.size());
+        slot_row_.push_back(0);
+        slot_generation_.push_back(0);
+    }
+    slot_row_[new_slot] = static_cast<uint32_t>(id.size() - 1);
+    slot.push_back(new_slot);
+    id_slot_[state.track.id] = new_slot;
+    
+    TrackHandle handle;
+    handle.slot = new_slot;
+    handle.generation = slot_generation_[new_slot];
+    return handle;
+}
+
+TrackState TrackStore::get(size_t index) const {
+    TrackState state;
+    state.track = track(index);
+    state.motion_model = motion_model[index];
+    state.acceleration_ms2 = acceleration_ms2[index];
+    state.angular_velocity_rads = angular_velocity_rads[index];
+    state.active = active[index] != 0;
+    state.age_cycles = age_cycles[index];
+    state.last_update_time_s = last_update_time_s[index];
+    state.entry_time_s = entry_time_s[index];
+    state.trajectory = trajectory[index];
+    state.trajectory_leg = trajectory_leg[index];
+    for (const EnuState& entry : history[index]) {
+        c2::Track past;
+        past.id = id[index];
+        common::toSpherical(entry, past);
+        state.history.push_back(past);
+    }
+    return state;
+}
+
+void TrackStore::set(size_t index, const TrackState& state) {
+    if (id[index] != state.track.id) {
+        id_slot_.erase(id[index]);
+        id_slot_[state.track.id] = slot[index];
+    }
+    id[index] = state.track.id;
+    setEnu(index, common::toEnu(state.track));
+    motion_model[index] = state.motion_model;
+    acceleration_ms2[index] = state.acceleration_ms2;
+    angular_velocity_rads[index] = state.angular_velocity_rads;
+    active[index] = state.active ? 1 : 0;
+    age_cycles[index] = state.age_cycles;
+    last_update_time_s[index] = state.last_update_time_s;
+    entry_time_s[index] = state.entry_time_s;
+    trajectory[index] = state.trajectory;
+    trajectory_leg[index] = state.trajectory_leg;
+    history[index].clear();
+    for (const c2::Track& entry : state.history) {
+        history[index].push_back(common::toEnu(entry));
+    }
+}
+
+c2::Track TrackStore::track(size_t index) const {
+    c2::Track t;
+    t.id = id[index];
+    common::toSpherical(enu(index), t);
+    return t;
+}
+
+EnuState TrackStore::enu(size_t index) const {
+    EnuState state;
+    state.east_m = east_m[index];
+    state.north_m = north_m[index];
+    state.up_m = up_m[index];
+    state.vel_east_ms = vel_east_ms[index];
+    state.vel_north_ms = vel_north_ms[index];
+    state.vel_up_ms = vel_up_ms[index];
+    return state;
+}
+
+void TrackStore::setEnu(size_t index, const EnuState& state) {
+    east_m[index] = state.east_m;
+    north_m[index] = state.north_m;
+    up_m[index] = state.up_m;
+    vel_east_ms[index] = state.vel_east_ms;
+    vel_north_ms[index] = state.vel_north_ms;
+    vel_up_ms[index] = state.vel_up_ms;
+}
+
+TrackHandle TrackStore::handle(size_t index) const {
+    TrackHandle result;
+    result.slot = slot[index];
+    result.generation = slot_generation_[result.slot];
+    return result;
+}
+
+bool TrackStore::resolve(TrackHandle handle, size_t& index) const {
+    if (handle.slot >= slot_row_.size() ||
+        slot_generation_[handle.slot] != handle.generation) {
+        return false;
+    }
+    index = slot_row_[handle.slot];
+    return true;
+}
+
+bool TrackStore::find(uint32_t track_id, size_t& index) const {
+    auto it = id_slot_.find(track_id);
+    if (it == id_slot_.end()) {
+        return false;
+    }
+    index = slot_row_[it->second];
+    return true;
+}
+
+void TrackStore::remove(size_t index) {
+    // Retire the slot so outstanding handles stop resolving
+    const uint32_t removed_slot = slot[index];
+    slot_generation_[removed_slot]++;
+    free_slots_.push_back(removed_slot);
+    id_slot_.erase(id[index]);
+    
+    // The last row takes over the hole
+    const uint32_t moved_slot = slot.back();
+    slot_row_[moved_slot] = static_cast<uint32_t>(index);
+    
+    swapPop(id, index);
+    swapPop(east_m, index);
+    swapPop(north_m, index);
+    swapPop(up_m, index);
+    swapPop(vel_east_ms, index);
+    swapPop(vel_north_ms, index);
+    swapPop(vel_up_ms, index);
+    swapPop(motion_model, index);
+    swapPop(acceleration_ms2, index);
+    swapPop(angular_velocity_rads, index);
+    swapPop(active, index);
+    swapPop(age_cycles, index);
+    swapPop(last_update_time_s, index);
+    swapPop(entry_time_s, index);
+    swapPop(trajectory, index);
+    swapPop(trajectory_leg, index);
+    swapPop(history, index);
+    swapPop(slot, index);
+}
+
+void TrackStore::retain(const std::vector<uint8_t>& keep) {
+    // Back to front, so every row moved into a hole has already been checked
+    for (size_t i = size(); i-- > 0;) {
+        if (!keep[i]) {
+            remove(i);
+        }
+    }
+}
+
+void TrackStore::swapRows(size_t a, size_t b) {
+    if (a == b) {
+        return;
+    }
+    slot_row_[slot[a]] = static_cast<uint32_t>(b);
+    slot_row_[slot[b]] = static_cast<uint32_t>(a);
+    
+    std::swap(id[a], id[b]);
+    std::swap(east_m[a], east_m[b]);
+    std::swap(north_m[a], north_m[b]);
+    std::swap(up_m[a], up_m[b]);
+    std::swap(vel_east_ms[a], vel_east_ms[b]);
+    std::swap(vel_north_ms[a], vel_north_ms[b]);
+    std::swap(vel_up_ms[a], vel_up_ms[b]);
+    std::swap(motion_model[a], motion_model[b]);
+    std::swap(acceleration_ms2[a], acceleration_ms2[b]);
+    std::swap(angular_velocity_rads[a], angular_velocity_rads[b]);
+    std::swap(active[a], active[b]);
+    std::swap(age_cycles[a], age_cycles[b]);
+    std::swap(last_update_time_s[a], last_update_time_s[b]);
+    std::swap(entry_time_s[a], entry_time_s[b]);
+    std::swap(trajectory[a], trajectory[b]);
+    std::swap(trajectory_leg[a], trajectory_leg[b]);
+    std::swap(history[a], history[b]);
+    std::swap(slot[a], slot[b]);
+}
+
+size_t TrackStore::activeCount() const {
+    return static_cast<size_t>(std::count(active.begin(), active.end(), 1));
+}
+
+} // namespace radar
+} // namespace skyguardis
@@ -0,0 +1,234 @@
+#include "radar_simulator/trajectory_table.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+namespace skyguardis {
+namespace radar {
+
+namespace {
+
+struct Waypoint {
+    double east_m;
+    double north_m;
+    double up_m;
+    double speed_ms;              // Speed on the leg ending here (unused for the first)
+};
+
+} // namespace
+
+TrajectoryTable::TrajectoryTable() {}
+
+void TrajectoryTable::clear() {
+    leg_start_s_.clear();
+    leg_state_.clear();
+    path_first_leg_.clear();
+    path_leg_count_.clear();
+    path_duration_s_.clear();
+    tracks_.clear();
+    error_.clear();
+}
+
+bool TrajectoryTable::fail(size_t line, const std::string& message) {
+    std::string error = "line " + std::to_string(line) + ": " + message;
+    clear();
+    error_ = error;
+    return false;
+}
+
+bool TrajectoryTable::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        clear();
+        error_ = "cannot open " + path;
+        return false;
+    }
+    return parse(file);
+}
+
+bool TrajectoryTable::parse(std::istream& input) {
+    clear();
+
+    // Current track block
+    bool in_block = false;
+    int64_t first_id = 0;
+    double spawn_time_s = 0.0;
+    int64_t count = 1;
+    double interval_s = 0.0;
+    double spacing[3] = {0.0, 0.0, 0.0};
+    std::vector<Waypoint> waypoints;
+    std::unordered_set<uint32_t> ids;
+
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(input, line)) {
+        ++line_number;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+
+        std::istringstream words(line);
+        std::string keyword;
+        if (!(words >> keyword)) {
+            continue;
+        }
+
+        std::string extra;
+        if (keyword == "track") {
+            if (in_block) {
+                return fail(line_number, "'track' before 'end' of the previous track");
+            }
+            std::string spawn_word;
+            if (!(words >> first_id >> spawn_word >> spawn_time_s) || spawn_word != "spawn") {
+                return fail(line_number, "expected 'track <id> spawn <time_s>'");
+            }
+            if (first_id < 0 || first_id > UINT32_MAX || spawn_time_s < 0.0) {
+                return fail(line_number, "track id or spawn time out of range");
+            }
+
+            count = 1;
+            interval_s = 0.0;
+            spacing[0] = spacing[1] = spacing[2] = 0.0;
+            std::string option;
+            while (words >> option) {
+                if (option == "count") {
+                    std::string every_word;
+                    if (!(words >> count >> every_word >> interval_s) || every_word != "every" ||
+                        count < 1 || interval_s < 0.0) {
+                        return fail(line_number, "expected 'count <n> every <interval_s>'");
+                    }
+                } else if (option == "spacing") {
+                    if (!(words >> spacing[0] >> spacing[1] >> spacing[2])) {
+                        return fail(line_number, "expected 'spacing <east_m> <north_m> <up_m>'");
+                    }
+                } else {
+                    return fail(line_number, "unknown track option '" + option + "'");
+                }
+            }
+            if (first_id + count - 1 > UINT32_MAX) {
+                return fail(line_number, "track ids out of range");
+            }
+
+            waypoints.clear();
+            in_block = true;
+        } else if (keyword == "waypoint") {
+            if (!in_block) {
+                return fail(line_number, "'waypoint' outside a track block");
+            }
+            Waypoint point;
+            if (!(words >> point.east_m >> point.north_m >> point.up_m)) {
+                return fail(line_number, "expected 'waypoint <east_m> <north_m> <up_m> [speed_ms]'");
+            }
+            point.speed_ms = 0.0;
+            if (!waypoints.empty()) {
+                if (!(words >> point.speed_ms) || point.speed_ms <= 0.0) {
+                    return fail(line_number, "waypoint after the first needs a positive speed");
+                }
+                const Waypoint& previous = waypoints.back();
+                if (point.east_m == previous.east_m && point.north_m == previous.north_m &&
+                    point.up_m == previous.up_m) {
+                    return fail(line_number, "waypoint repeats the previous position");
+                }
+            }
+            if (words >> extra) {
+                return fail(line_number, "unexpected '" + extra + "'");
+            }
+            waypoints.push_back(point);
+        } else if (keyword == "end") {
+            if (!in_block) {
+                return fail(line_number, "'end' outside a track block");
+            }
+            if (words >> extra) {
+                return fail(line_number, "unexpected '" + extra + "'");
+            }
+            if (waypoints.size() < 2) {
+                return fail(line_number, "a track needs at least two waypoints");
+            }
+
+            // Compile the path into legs
+            const uint32_t path = static_cast<uint32_t>(path_first_leg_.size());
+            path_first_leg_.push_back(static_cast<uint32_t>(leg_start_s_.size()));
+            path_leg_count_.push_back(static_cast<uint32_t>(waypoints.size() - 1));
+            double leg_start_s = 0.0;
+            for (size_t i = 1; i < waypoints.size(); ++i) {
+                const Waypoint& from = waypoints[i - 1];
+                const Waypoint& to = waypoints[i];
+                const double de = to.east_m - from.east_m;
+                const double dn = to.north_m - from.north_m;
+                const double du = to.up_m - from.up_m;
+                const double duration_s = std::sqrt(de * de + dn * dn + du * du) / to.speed_ms;
+
+                EnuState leg;
+                leg.east_m = from.east_m;
+                leg.north_m = from.north_m;
+                leg.up_m = from.up_m;
+                leg.vel_east_ms = de / duration_s;
+                leg.vel_north_ms = dn / duration_s;
+                leg.vel_up_ms = du / duration_s;
+                leg_start_s_.push_back(leg_start_s);
+                leg_state_.push_back(leg);
+                leg_start_s += duration_s;
+            }
+            path_duration_s_.push_back(leg_start_s);
+
+            // Expand the block into its tracks
+            for (int64_t k = 0; k < count; ++k) {
+                ScriptedTrack scripted;
+                scripted.track_id = static_cast<uint32_t>(first_id + k);
+                scripted.path = path;
+                scripted.spawn_time_s = spawn_time_s + k * interval_s;
+                scripted.offset_east_m = k * spacing[0];
+                scripted.offset_north_m = k * spacing[1];
+                scripted.offset_up_m = k * spacing[2];
+                if (!ids.insert(scripted.track_id).second) {
+                    return fail(line_number, "duplicate track id " + std::to_string(scripted.track_id));
+                }
+                tracks_.push_back(scripted);
+            }
+            in_block = false;
+        } else {
+            return fail(line_number, "unknown directive '" + keyword + "'");
+        }
+    }
+
+    if (in_block) {
+        return fail(line_number, "missing 'end'");
+    }
+
+    std::stable_sort(tracks_.begin(), tracks_.end(),
+                     [](const ScriptedTrack& a, const ScriptedTrack& b) {
+                         return a.spawn_time_s < b.spawn_time_s;
+                     });
+    return true;
+}
+
+bool TrajectoryTable::sample(const ScriptedTrack& track, double time_s, uint32_t& leg,
+                             EnuState& state) const {
+    const uint32_t first = path_first_leg_[track.path];
+    const uint32_t last = first + path_leg_count_[track.path] - 1;
+
+    // Resume from the cursor; rewind if it is foreign or ahead of time_s
+    if (leg < first || leg > last || time_s < leg_start_s_[leg]) {
+        leg = first;
+    }
+    while (leg < last && time_s >= leg_start_s_[leg + 1]) {
+        ++leg;
+    }
+
+    const double duration_s = path_duration_s_[track.path];
+    const double t = std::max(0.0, std::min(time_s, duration_s) - leg_start_s_[leg]);
+    const EnuState& from = leg_state_[leg];
+    state.east_m = from.east_m + from.vel_east_ms * t + track.offset_east_m;
+    state.north_m = from.north_m + from.vel_north_ms * t + track.offset_north_m;
+    state.up_m = from.up_m + from.vel_up_ms * t + track.offset_up_m;
+    state.vel_east_ms = from.vel_east_ms;
+    state.vel_north_ms = from.vel_north_ms;
+    state.vel_up_ms = from.vel_up_ms;
+    return time_s <= duration_s;
+}
+
+} // namespace radar
+} // namespace skyguardis
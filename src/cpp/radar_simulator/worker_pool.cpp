@@ -0,0 +1,84 @@
+#include "radar_simulator/worker_pool.hpp"
+
+namespace skyguardis {
+namespace radar {
+
+WorkerPool::WorkerPool(size_t thread_count)
+    : task_(nullptr), task_count_(0), next_task_(0), busy_workers_(0),
+      generation_(0), stopping_(false) {
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkerPool::parallelFor(size_t task_count, const std::function<void(size_t)>& task) {
+    if (task_count == 0) return;
+    
+    // Nothing to share: run inline without touching the workers
+    if (threads_.empty() || task_count == 1) {
+        for (size_t i = 0; i < task_count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = task_count;
+        next_task_.store(0, std::memory_order_relaxed);
+        busy_workers_ = threads_.size();
+        ++generation_;
+    }
+    work_ready_.notify_all();
+    
+    runTasks();
+    
+    // Every worker must have left the job before `task` goes out of scope
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_done_.wait(lock, [this] { return busy_workers_ == 0; });
+    task_ = nullptr;
+}
+
+void WorkerPool::runTasks() {
+    for (;;) {
+        size_t index = next_task_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= task_count_) break;
+        (*task_)(index);
+    }
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seen_generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_ready_.wait(lock, [&] { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) return;
+            seen_generation = generation_;
+        }
+        
+        runTasks();
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --busy_workers_;
+        }
+        work_done_.notify_one();
+    }
+}
+
+} // namespace radar
+} // namespace skyguardis
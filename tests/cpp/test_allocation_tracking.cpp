@@ -0,0 +1,230 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "common/alloc_tracker.hpp"
+#include "common/cycle_arena.hpp"
+#include "common/sim_clock.hpp"
+#include "c2_controller/c2_controller.hpp"
+#include "message_gateway/message_gateway.hpp"
+#include "radar_simulator/radar_simulator.hpp"
+#include "logger/logger.hpp"
+#include "logger/visualizer.hpp"
+
+using namespace skyguardis;
+using namespace skyguardis::common;
+
+// Allocations escape here so the optimizer cannot elide them
+void* volatile allocation_sink;
+
+// Counts are checked in every build type, not only where assert() is live
+void check(bool ok, const char* what) {
+    if (!ok) {
+        throw std::runtime_error(what);
+    }
+}
+
+// Test: Allocations are charged to the phase that made them
+void test_phase_attribution() {
+    std::cout << "  Testing phase attribution...\n";
+    assert(allocationTrackingEnabled() && "Test is built with SKYGUARDIS_TRACK_ALLOCATIONS");
+
+    const AllocationCounts before = allocationCounts();
+    {
+        AllocationPhase logging(CyclePhase::LOGGING);
+        std::unique_ptr<int> one(new int(1));
+        allocation_sink = one.get();
+        {
+            AllocationPhase visualization(CyclePhase::VISUALIZATION);
+            std::vector<double> values(100);
+            allocation_sink = values.data();
+            assert(allocationPhase() == CyclePhase::VISUALIZATION);
+        }
+        assert(allocationPhase() == CyclePhase::LOGGING && "Inner scope restores the phase");
+        std::unique_ptr<int[]> many(new int[10]);
+        allocation_sink = many.get();
+    }
+    assert(allocationPhase() == CyclePhase::IDLE && "Outer scope restores the phase");
+
+    const AllocationCounts counted = allocationCounts() - before;
+    check(counted.of(CyclePhase::LOGGING) == 2, "new and new[] counted");
+    check(counted.of(CyclePhase::VISUALIZATION) == 1, "Container allocation counted");
+    check(counted.bytes[static_cast<size_t>(CyclePhase::VISUALIZATION)] == 100 * sizeof(double),
+          "Container bytes counted");
+    check(counted.of(CyclePhase::RADAR_UPDATE) == 0 && counted.of(CyclePhase::THREAT_EVALUATION) == 0,
+          "Idle phases not charged");
+    check(counted.total() == 3, "Nothing else allocated");
+    assert(std::string(phaseName(CyclePhase::THREAT_EVALUATION)) == "threat_evaluation");
+
+    std::cout << "  ✓ Phase attribution test passed\n";
+}
+
+// Test: C allocations are counted as well
+void test_malloc_counted() {
+    std::cout << "  Testing malloc counting...\n";
+
+#if defined(__GLIBC__)
+    const AllocationCounts before = allocationCounts();
+    {
+        AllocationPhase phase(CyclePhase::RADAR_UPDATE);
+        void* block = std::malloc(64);
+        allocation_sink = block;
+        block = std::realloc(block, 128);
+        allocation_sink = block;
+        void* zeroed = std::calloc(4, 8);
+        allocation_sink = zeroed;
+        std::free(block);
+        std::free(zeroed);
+    }
+    const AllocationCounts counted = allocationCounts() - before;
+    check(counted.of(CyclePhase::RADAR_UPDATE) == 3, "malloc, realloc and calloc counted");
+    check(counted.bytes[static_cast<size_t>(CyclePhase::RADAR_UPDATE)] == 64 + 128 + 32,
+          "C allocation bytes counted");
+    std::cout << "  ✓ Malloc counting test passed\n";
+#else
+    std::cout << "    (malloc is only interposed on glibc)\n";
+#endif
+}
+
+// Test: Once warmed up, a full C2 cycle (radar update, threat evaluation,
+// assignment, logging, visualization) does not touch the heap
+void test_steady_state_cycles() {
+    std::cout << "  Testing steady-state C2 cycles...\n";
+
+    const int WARMUP_CYCLES = 10;
+    const int CYCLES = 60;
+
+    VirtualClock clock;
+    radar::RadarSimulator radar;
+    radar.setClock(&clock);
+    radar.setRandomSeed(20);
+    radar::ScenarioConfig config;
+    config.target_count = 2000;
+    config.wave_count = 1;
+    config.spawn_rate_per_s = 0.0;
+    config.detection_zone_radius_m = 1.0e7;   // Tracks only leave through min_range_m
+    config.min_range_m = 1000.0;
+    config.max_range_m = 10000.0;
+    config.min_elevation_rad = -1.6;
+    config.max_elevation_rad = 1.6;
+    radar.setScenario(radar::ScenarioType::MASS_RAID, config);
+
+    gateway::MessageGateway gateway;
+    check(gateway.initialize(8888, 8889), "Gateway initialization");
+    c2::C2Controller controller;
+    controller.setMessageGateway(&gateway);
+    logger::Logger log;
+    log.setClock(&clock);
+    log.enableConsoleOutput(false);
+    log.setLogFile("/tmp/test_allocation_tracking.log");
+    logger::Visualizer visualizer;
+    visualizer.setUpdateInterval(5);
+
+    CycleArena arena;
+    controller.setCycleArena(&arena);
+    log.setCycleArena(&arena);
+    visualizer.setCycleArena(&arena);
+
+    protocol::EngagementStatus status;
+    status.target_id = 1;
+    status.state = 2;
+    status.firing = 0;
+    status.lead_angle_rad = 0.01;
+    status.time_to_impact_s = 3.5;
+
+    // The controller reports each assignment on stdout; keep it (and the
+    // frames) off the test output. Reserve first so the capture itself
+    // does not grow during the measured cycles.
+    std::ostringstream screen;
+    screen.str(std::string(4 << 20, ' '));
+    screen.seekp(0);
+    std::streambuf* console = std::cout.rdbuf(screen.rdbuf());
+
+    AllocationCounts steady;
+    int allocating_cycles = 0;
+    CyclePhase first_offender = CyclePhase::IDLE;
+    for (int cycle = 0; cycle < CYCLES; ++cycle) {
+        clock.advance(0.1);
+        const AllocationCounts before = allocationCounts();
+
+        c2::TrackSpan tracks;
+        {
+            AllocationPhase phase(CyclePhase::RADAR_UPDATE);
+            radar.updateTracks(0.1);
+            tracks = radar.getSnapshot().tracks;
+        }
+        controller.processTracks(tracks);
+        {
+            AllocationPhase phase(CyclePhase::LOGGING);
+            log.logf(logger::LogLevel::DEBUG, "Cycle %d: Processed %zu tracks", cycle, tracks.size());
+            for (const auto& track : tracks) {
+                log.logTargetAssignment(track.id, track.range_m, track.azimuth_rad);
+            }
+            log.logEngagement(status);
+        }
+        {
+            AllocationPhase phase(CyclePhase::VISUALIZATION);
+            visualizer.visualizeDashboard(tracks, status, true);
+        }
+        arena.reset();
+
+        const AllocationCounts counted = allocationCounts() - before;
+        if (cycle >= WARMUP_CYCLES && counted.total() > 0) {
+            if (allocating_cycles == 0) {
+                for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+                    if (counted.allocations[p] > 0) {
+                        first_offender = static_cast<CyclePhase>(p);
+                        break;
+                    }
+                }
+            }
+            allocating_cycles++;
+        }
+        if (cycle >= WARMUP_CYCLES) {
+            for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+                steady.allocations[p] += counted.allocations[p];
+                steady.bytes[p] += counted.bytes[p];
+            }
+        }
+    }
+    std::cout.rdbuf(console);
+    gateway.shutdown();
+
+    if (allocating_cycles > 0) {
+        std::cout << "    ✗ " << allocating_cycles << " steady-state cycles allocated, first in "
+                  << phaseName(first_offender) << "\n";
+        for (size_t p = 0; p < CYCLE_PHASE_COUNT; ++p) {
+            std::cout << "      " << phaseName(static_cast<CyclePhase>(p)) << ": "
+                      << steady.allocations[p] << " allocations, " << steady.bytes[p] << " bytes\n";
+        }
+        std::cout.flush();
+    }
+    assert(allocating_cycles == 0 && "Steady-state cycles must not allocate");
+    const size_t remaining = radar.getActiveTrackCount();
+    assert(remaining > 0 && remaining < 2000 && "Tracks left the picture during the run");
+
+    std::cout << "    ✓ " << (CYCLES - WARMUP_CYCLES) << " cycles without a heap allocation ("
+              << remaining << " of 2000 tracks remaining)\n";
+    std::cout << "  ✓ Steady-state C2 cycles test passed\n";
+}
+
+int main() {
+    std::cout << "\nTesting Allocation Tracking...\n\n";
+
+    try {
+        test_phase_attribution();
+        test_malloc_counted();
+        test_steady_state_cycles();
+
+        std::cout << "\n✓ All allocation tracking tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n✗ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -39,7 +39,9 @@ void test_end_to_end_integration() {
 void test_multiple_engagement_cycles() {
     std::cout << "  Testing multiple engagement cycles...\n";
     
+    // Fixed seed: an unlucky random track can leave the zone within a second
     RadarSimulator radar;
+    radar.setRandomSeed(2);
     radar.setScenario(ScenarioType::SWARM);
     
     for (int i = 0; i < 10; ++i) {
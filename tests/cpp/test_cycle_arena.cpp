@@ -0,0 +1,195 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "common/cycle_arena.hpp"
+#include "c2_controller/c2_controller.hpp"
+#include "c2_controller/threat_evaluator.hpp"
+#include "logger/logger.hpp"
+#include "logger/visualizer.hpp"
+
+using namespace skyguardis;
+using namespace skyguardis::common;
+
+// Test: Bump allocation, alignment and reset
+void test_arena_allocation() {
+    std::cout << "  Testing arena allocation...\n";
+
+    CycleArena arena(4096);
+    assert(arena.capacity() == 4096 && "Initial capacity");
+    assert(arena.getStats().system_allocations == 1 && "One block up front");
+
+    char* first = static_cast<char*>(arena.allocate(3, 1));
+    double* aligned = static_cast<double*>(arena.allocate(sizeof(double) * 4, alignof(double)));
+    if (reinterpret_cast<uintptr_t>(aligned) % alignof(double) != 0) {
+        throw std::runtime_error("Aligned allocation");
+    }
+    if (reinterpret_cast<char*>(aligned) <= first) {
+        throw std::runtime_error("Allocations bump forward");
+    }
+    assert(arena.used() >= 3 + sizeof(double) * 4 && "Used bytes include padding");
+
+    arena.reset();
+    assert(arena.used() == 0 && "Reset frees the cycle");
+    char* reused = static_cast<char*>(arena.allocate(3, 1));
+    if (reused != first) {
+        throw std::runtime_error("Next cycle reuses the block");
+    }
+    assert(arena.getStats().cycles == 1 && arena.getStats().allocations == 3);
+    assert(arena.getStats().system_allocations == 1 && "No system allocation after warm-up");
+
+    std::cout << "  ✓ Arena allocation test passed\n";
+}
+
+// Test: A cycle larger than the block spills, then the block grows to fit
+void test_arena_growth() {
+    std::cout << "  Testing arena growth...\n";
+
+    CycleArena arena(1024);
+    for (int i = 0; i < 10; ++i) {
+        void* block = arena.allocate(500);
+        std::memset(block, i, 500);
+    }
+    assert(arena.getStats().system_allocations > 1 && "Overflow spills into extra blocks");
+    const size_t cycle_bytes = arena.used();
+    arena.reset();
+    assert(arena.getStats().last_cycle_system_allocations > 0 && "Warm-up cycle counted");
+    assert(arena.capacity() >= cycle_bytes && "Block regrown to the cycle's size");
+    assert(arena.getStats().peak_bytes == cycle_bytes && "Peak recorded");
+
+    // The same load now fits without touching operator new
+    for (int cycle = 0; cycle < 20; ++cycle) {
+        for (int i = 0; i < 10; ++i) {
+            arena.allocate(500);
+        }
+        arena.reset();
+        assert(arena.getStats().last_cycle_system_allocations == 0 && "Steady state stays in the block");
+    }
+
+    std::cout << "    ✓ " << arena.capacity() << " byte block after a " << cycle_bytes
+              << " byte cycle\n";
+    std::cout << "  ✓ Arena growth test passed\n";
+}
+
+// Test: Standard containers and text on the arena
+void test_arena_containers() {
+    std::cout << "  Testing arena containers...\n";
+
+    CycleArena arena;
+    {
+        ArenaVector<int> values((ArenaAllocator<int>(&arena)));
+        for (int i = 0; i < 10000; ++i) {
+            values.push_back(i);
+        }
+        for (int i = 0; i < 10000; ++i) {
+            assert(values[i] == i && "Vector contents survive regrowth");
+        }
+
+        ArenaText text(&arena, 8);
+        text.append("Tracks: ");
+        text.appendf("%d of %s", 42, "a much longer sentence than the initial capacity");
+        text.append('!', 3);
+        assert(std::string(text.c_str()) ==
+               "Tracks: 42 of a much longer sentence than the initial capacity!!!" && "Formatted text");
+        assert(text.size() == std::strlen(text.c_str()) && "Size matches the terminator");
+    }
+    assert(arena.used() > 10000 * sizeof(int) && "Containers drew from the arena");
+    arena.reset();
+
+    // Without an arena the same types use the heap
+    ArenaVector<double> heap_values;
+    heap_values.assign(1000, 1.5);
+    ArenaText heap_text(nullptr);
+    heap_text.appendf("%.1f", heap_values[999]);
+    assert(std::string(heap_text.c_str()) == "1.5" && "Heap fallback");
+
+    std::cout << "  ✓ Arena containers test passed\n";
+}
+
+// Test: The C2 cycle's transient data stays in the arena once warmed up
+void test_c2_cycle_steady_state() {
+    std::cout << "  Testing C2 cycle steady state...\n";
+
+    std::vector<c2::Track> tracks(1000);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i].id = static_cast<uint32_t>(i + 1);
+        tracks[i].range_m = 1000.0 + 20.0 * i;
+        tracks[i].azimuth_rad = 0.001 * i;
+        tracks[i].elevation_rad = 0.1;
+        tracks[i].velocity_ms = 100.0 + i % 300;
+        tracks[i].heading_rad = 3.0;
+    }
+    protocol::EngagementStatus status;
+    status.target_id = 7;
+    status.state = 2;
+    status.firing = 0;
+    status.lead_angle_rad = 0.01;
+    status.time_to_impact_s = 3.5;
+
+    CycleArena arena;
+    c2::C2Controller controller;
+    logger::Logger log;
+    logger::Visualizer visualizer;
+    controller.setCycleArena(&arena);
+    log.setCycleArena(&arena);
+    log.enableConsoleOutput(false);
+    log.setLogFile("/tmp/test_cycle_arena.log");
+    visualizer.setCycleArena(&arena);
+    visualizer.setUpdateInterval(5);
+
+    // Keep the frames off the test output
+    std::ostringstream screen;
+    std::streambuf* console = std::cout.rdbuf(screen.rdbuf());
+    size_t steady_cycles = 0;
+    for (int cycle = 0; cycle < 50; ++cycle) {
+        controller.processTracks(tracks);
+        log.logf(logger::LogLevel::DEBUG, "Cycle %d: Processed %zu tracks", cycle, tracks.size());
+        for (const auto& track : tracks) {
+            log.logTargetAssignment(track.id, track.range_m, track.azimuth_rad);
+        }
+        log.logEngagement(status);
+        visualizer.visualizeDashboard(tracks, status, true);
+        arena.reset();
+        if (cycle >= 10) {
+            assert(arena.getStats().last_cycle_system_allocations == 0 &&
+                   "Steady-state cycle without system allocations");
+            ++steady_cycles;
+        }
+    }
+    std::cout.rdbuf(console);
+    assert(screen.str().find("ACTIVE TRACKS: 1000") != std::string::npos && "Frames rendered");
+
+    std::ifstream log_file("/tmp/test_cycle_arena.log");
+    std::string first_line;
+    std::getline(log_file, first_line);
+    assert(first_line.find("[INFO ] Target Assignment: id=1 range=1000m azimuth=0rad") != std::string::npos &&
+           "Log line format unchanged");
+
+    const ArenaStats& stats = arena.getStats();
+    std::cout << "    ✓ " << steady_cycles << " steady cycles, " << stats.allocations
+              << " arena allocations, " << stats.system_allocations << " system allocations, "
+              << stats.peak_bytes / 1024 << " KB peak\n";
+    std::cout << "  ✓ C2 cycle steady state test passed\n";
+}
+
+int main() {
+    std::cout << "\nTesting Cycle Arena...\n\n";
+
+    try {
+        test_arena_allocation();
+        test_arena_growth();
+        test_arena_containers();
+        test_c2_cycle_steady_state();
+
+        std::cout << "\n✓ All cycle arena tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n✗ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <fstream>
 #include <sstream>
+#include "common/sim_clock.hpp"
 #include "logger/logger.hpp"
 
 using namespace skyguardis::logger;
@@ -146,6 +147,39 @@ void test_thread_safety() {
     std::cout << "  ✓ Thread safety test passed\n";
 }
 
+// Test: Timestamps follow an injected virtual clock
+void test_virtual_clock_timestamps() {
+    std::cout << "  Testing virtual clock timestamps...\n";
+    
+    skyguardis::common::VirtualClock clock;
+    Logger logger;
+    logger.setLogFile("/tmp/test_virtual_clock.log");
+    logger.enableConsoleOutput(false);
+    logger.setClock(&clock);
+    
+    logger.info("First");
+    clock.advance(3600.25); // One simulated hour, no real waiting
+    logger.info("Second");
+    
+    std::ifstream log_file("/tmp/test_virtual_clock.log");
+    std::string first, second;
+    std::getline(log_file, first);
+    std::getline(log_file, second);
+    
+    // Timestamp format: [YYYY-MM-DD HH:MM:SS.mmm]; the hour moves, minutes
+    // and seconds stay, milliseconds move by exactly 250
+    int first_ms = std::stoi(first.substr(21, 3));
+    int second_ms = std::stoi(second.substr(21, 3));
+    assert(second_ms == (first_ms + 250) % 1000 && "Milliseconds follow the virtual clock");
+    if (first_ms < 750) {
+        assert(first.substr(15, 5) == second.substr(15, 5) && "Minutes and seconds unchanged");
+    }
+    assert(first.substr(12, 2) != second.substr(12, 2) && "Hour advanced");
+    
+    std::cout << "    ✓ " << first.substr(0, 25) << " -> " << second.substr(0, 25) << "\n";
+    std::cout << "  ✓ Virtual clock timestamps test passed\n";
+}
+
 int main() {
     std::cout << "\nTesting Enhanced Logging System...\n\n";
     
@@ -155,6 +189,7 @@ int main() {
         test_specialized_logging();
         test_performance_metrics();
         test_thread_safety();
+        test_virtual_clock_timestamps();
         
         std::cout << "\n✓ All enhanced logging tests passed!\n";
         return 0;
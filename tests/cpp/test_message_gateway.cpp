@@ -1,8 +1,10 @@
 #include "message_gateway/protocol.hpp"
 #include "message_gateway/message_gateway.hpp"
+#include "message_gateway/track_stream.hpp"
 #include <cassert>
 #include <iostream>
 #include <cstring>
+#include <vector>
 
 void test_serialization() {
     std::cout << "Testing message serialization..." << std::endl;
@@ -93,6 +95,119 @@ void test_message_gateway_initialization() {
     }
 }
 
+void test_track_report_serialization() {
+    std::cout << "Testing track report serialization..." << std::endl;
+    using skyguardis::protocol::TrackReport;
+    
+    std::vector<skyguardis::c2::Track> tracks(3);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i].id = static_cast<uint32_t>(100 + i);
+        tracks[i].range_m = 1000.0 * (i + 1);
+        tracks[i].azimuth_rad = 0.1 * i;
+        tracks[i].elevation_rad = 0.05;
+        tracks[i].velocity_ms = 250.0;
+        tracks[i].heading_rad = -1.0;
+    }
+    
+    TrackReport report;
+    report.cycle = 77;
+    report.batch_index = 0;
+    report.batch_count = 1;
+    report.track_count = static_cast<uint16_t>(tracks.size());
+    
+    std::vector<uint8_t> buffer(TrackReport::serializedSize(tracks.size()));
+    bool success = skyguardis::protocol::serializeTrackReport(report, tracks.data(),
+                                                              buffer.data(), buffer.size());
+    assert(success);
+    assert(buffer[0] == static_cast<uint8_t>(skyguardis::protocol::MessageType::TRACK_REPORT));
+    
+    TrackReport decoded_report;
+    std::vector<skyguardis::c2::Track> decoded(TrackReport::MAX_TRACKS);
+    success = skyguardis::protocol::deserializeTrackReport(buffer.data(), buffer.size(), decoded_report,
+                                                           decoded.data(), decoded.size());
+    assert(success);
+    assert(decoded_report.cycle == 77 && decoded_report.track_count == 3);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        assert(decoded[i].id == tracks[i].id);
+        assert(decoded[i].range_m == tracks[i].range_m);
+        assert(decoded[i].heading_rad == tracks[i].heading_rad);
+    }
+    
+    // Corruption and truncation are rejected
+    buffer[20] ^= 0xFF;
+    success = skyguardis::protocol::deserializeTrackReport(buffer.data(), buffer.size(), decoded_report,
+                                                           decoded.data(), decoded.size());
+    assert(!success);
+    buffer[20] ^= 0xFF;
+    success = skyguardis::protocol::deserializeTrackReport(buffer.data(), buffer.size() - 1, decoded_report,
+                                                           decoded.data(), decoded.size());
+    assert(!success);
+    
+    std::cout << "  ✓ Track report serialization passed" << std::endl;
+}
+
+void test_track_stream() {
+    std::cout << "Testing track stream over loopback..." << std::endl;
+    
+    const uint16_t port = 18890;
+    skyguardis::gateway::TrackStreamReceiver receiver;
+    if (!receiver.initialize(port)) {
+        std::cout << "  ⚠ Track stream test skipped (port may be in use)" << std::endl;
+        return;
+    }
+    skyguardis::gateway::TrackStreamSender sender;
+    bool success = sender.initialize(port);
+    assert(success);
+    
+    // 2500 tracks -> 3 datagrams per cycle
+    std::vector<skyguardis::c2::Track> tracks(2500);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i].id = static_cast<uint32_t>(i + 1);
+        tracks[i].range_m = 5000.0 + i;
+        tracks[i].azimuth_rad = 0.0;
+        tracks[i].elevation_rad = 0.0;
+        tracks[i].velocity_ms = 100.0;
+        tracks[i].heading_rad = 0.0;
+    }
+    
+    success = sender.sendTracks(1, tracks);
+    assert(success);
+    assert(sender.getDatagramsSent() == 3);
+    success = sender.sendTracks(2, skyguardis::c2::TrackSpan());
+    assert(success);
+    
+    // Loopback delivery is immediate, but allow a few polls
+    bool completed = false;
+    for (int attempt = 0; attempt < 100 && receiver.getStats().cycles_completed < 2; ++attempt) {
+        completed |= receiver.poll();
+    }
+    assert(completed);
+    assert(receiver.getStats().cycles_completed == 2);
+    assert(receiver.getCycle() == 2 && receiver.getTracks().empty() && "Empty cycle delivered");
+    
+    // Resend cycle 3 and check reassembly order
+    success = sender.sendTracks(3, tracks);
+    assert(success);
+    for (int attempt = 0; attempt < 100 && receiver.getCycle() != 3; ++attempt) {
+        receiver.poll();
+    }
+    assert(receiver.getCycle() == 3);
+    assert(receiver.getTracks().size() == tracks.size());
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        assert(receiver.getTracks()[i].id == tracks[i].id);
+    }
+    
+    // Stale cycles are ignored
+    success = sender.sendTracks(1, tracks);
+    assert(success);
+    receiver.poll();
+    assert(receiver.getCycle() == 3);
+    assert(receiver.getStats().reports_rejected >= 1);
+    
+    std::cout << "  ✓ Track stream passed (" << receiver.getStats().cycles_completed
+              << " cycles reassembled)" << std::endl;
+}
+
 int main() {
     std::cout << "Running message gateway tests..." << std::endl;
     std::cout << std::endl;
@@ -101,6 +216,8 @@ int main() {
         test_serialization();
         test_checksum();
         test_message_gateway_initialization();
+        test_track_report_serialization();
+        test_track_stream();
         
         std::cout << std::endl;
         std::cout << "All tests passed!" << std::endl;
@@ -0,0 +1,272 @@
+#include "c2_controller/plot_associator.hpp"
+#include "c2_controller/tracker_bank.hpp"
+#include "radar_simulator/counter_rng.hpp"
+#include "radar_simulator/motion_kernels.hpp"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace skyguardis::c2;
+using namespace skyguardis::radar;
+namespace common = skyguardis::common;
+
+namespace {
+
+const double TRACK_SIGMA_M = 20.0;
+const double PLOT_SIGMA_M = 30.0;
+
+void setDiagonal(PositionSet& set, size_t index, double east, double north, double up,
+                 double sigma_m) {
+    const double position[3] = {east, north, up};
+    const double matrix[3][3] = {{sigma_m * sigma_m, 0.0, 0.0},
+                                 {0.0, sigma_m * sigma_m, 0.0},
+                                 {0.0, 0.0, sigma_m * sigma_m}};
+    set.set(index, position, matrix);
+}
+
+// Tracks scattered over a box, and one noisy plot per track (shuffled)
+void makeScene(size_t count, double extent_m, uint64_t seed,
+               PositionSet& tracks, PositionSet& plots, std::vector<uint32_t>& truth_plot) {
+    tracks.resize(count);
+    plots.resize(count);
+    truth_plot.resize(count);
+    std::vector<uint32_t> order(count);
+    for (size_t t = 0; t < count; ++t) {
+        order[t] = static_cast<uint32_t>(t);
+    }
+    CounterRng shuffle(seed, 0, 0, CounterRng::Stream::TRACK_SPAWN);
+    for (size_t t = count; t > 1; --t) {
+        std::swap(order[t - 1], order[shuffle.next() % t]);
+    }
+    for (size_t t = 0; t < count; ++t) {
+        CounterRng rng(seed, static_cast<uint32_t>(t), 1, CounterRng::Stream::MEASUREMENT);
+        const double east = rng.uniform(-extent_m, extent_m);
+        const double north = rng.uniform(-extent_m, extent_m);
+        const double up = rng.uniform(100.0, 5000.0);
+        setDiagonal(tracks, t, east, north, up, TRACK_SIGMA_M);
+        const uint32_t p = order[t];
+        setDiagonal(plots, p, east + PLOT_SIGMA_M * rng.gaussian(),
+                    north + PLOT_SIGMA_M * rng.gaussian(), up + PLOT_SIGMA_M * rng.gaussian(),
+                    PLOT_SIGMA_M);
+        truth_plot[t] = p;
+    }
+}
+
+// Summed cost of an assignment: distance per assigned pair, gate per miss
+double assignmentCost(const PositionSet& tracks, const PositionSet& plots,
+                      const std::vector<uint32_t>& plot_for_track, double gate_chi2) {
+    const double variance = TRACK_SIGMA_M * TRACK_SIGMA_M + PLOT_SIGMA_M * PLOT_SIGMA_M;
+    double cost = 0.0;
+    for (size_t t = 0; t < plot_for_track.size(); ++t) {
+        const uint32_t p = plot_for_track[t];
+        if (p == NO_PLOT) {
+            cost += gate_chi2;
+            continue;
+        }
+        const double de = plots.east_m[p] - tracks.east_m[t];
+        const double dn = plots.north_m[p] - tracks.north_m[t];
+        const double du = plots.up_m[p] - tracks.up_m[t];
+        cost += (de * de + dn * dn + du * du) / variance;
+    }
+    return cost;
+}
+
+} // namespace
+
+// Test: Grid gating finds the same pairs as testing every plot
+void test_grid_gating() {
+    std::cout << "  Testing grid gating...\n";
+
+    PositionSet tracks, plots;
+    std::vector<uint32_t> truth;
+    makeScene(2000, 3000.0, 5, tracks, plots, truth);
+
+    AssociatorConfig config;
+    PlotAssociator grid(config);
+    config.cell_size_m = 1.0e9; // One cell: every plot is tested
+    PlotAssociator brute(config);
+
+    std::vector<uint32_t> grid_result, brute_result;
+    grid.associate(tracks, plots, grid_result);
+    brute.associate(tracks, plots, brute_result);
+    assert(grid.getStats().gated_pairs == brute.getStats().gated_pairs && "Grid misses no pair");
+    assert(grid.getStats().gated_pairs >= tracks.size() && "Dense scene has contested gates");
+    assert(std::fabs(assignmentCost(tracks, plots, grid_result, config.gate_chi2) -
+                     assignmentCost(tracks, plots, brute_result, config.gate_chi2)) <
+           tracks.size() * config.auction_epsilon && "Same assignment cost");
+
+    // Plots used at most once
+    std::vector<uint8_t> used(plots.size(), 0);
+    for (uint32_t p : grid_result) {
+        if (p != NO_PLOT) {
+            assert(!used[p] && "Plot assigned twice");
+            used[p] = 1;
+        }
+    }
+
+    std::cout << "    ✓ " << grid.getStats().gated_pairs << " gated pairs, "
+              << grid.getStats().assigned << "/" << tracks.size() << " assigned\n";
+    std::cout << "  ✓ Grid gating test passed\n";
+}
+
+// Test: Auction matches an exhaustive search on small conflicts
+void test_auction_optimality() {
+    std::cout << "  Testing auction optimality...\n";
+
+    AssociatorConfig config;
+    PlotAssociator associator(config);
+    for (uint64_t seed = 0; seed < 50; ++seed) {
+        // 5 tracks competing for 5 plots in a 100 m box
+        PositionSet tracks, plots;
+        std::vector<uint32_t> truth;
+        makeScene(5, 50.0, seed, tracks, plots, truth);
+
+        std::vector<uint32_t> result;
+        associator.associate(tracks, plots, result);
+        const double auction_cost = assignmentCost(tracks, plots, result, config.gate_chi2);
+
+        // Every permutation, with pairs outside the gate counted as misses
+        std::vector<uint32_t> permutation = {0, 1, 2, 3, 4};
+        std::vector<uint32_t> candidate(5);
+        double best_cost = 1e300;
+        do {
+            const double variance = TRACK_SIGMA_M * TRACK_SIGMA_M + PLOT_SIGMA_M * PLOT_SIGMA_M;
+            for (size_t t = 0; t < 5; ++t) {
+                const uint32_t p = permutation[t];
+                const double de = plots.east_m[p] - tracks.east_m[t];
+                const double dn = plots.north_m[p] - tracks.north_m[t];
+                const double du = plots.up_m[p] - tracks.up_m[t];
+                candidate[t] = (de * de + dn * dn + du * du) / variance <= config.gate_chi2 ? p : NO_PLOT;
+            }
+            best_cost = std::min(best_cost, assignmentCost(tracks, plots, candidate, config.gate_chi2));
+        } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+        assert(auction_cost <= best_cost + 5 * config.auction_epsilon + 1e-9 &&
+               "Auction within tracks * epsilon of optimal");
+    }
+
+    std::cout << "  ✓ Auction optimality test passed\n";
+}
+
+// Test: Tracker bank follows raw plots (no track ids) through association
+void test_association_tracking() {
+    std::cout << "  Testing association tracking...\n";
+
+    // Straight flights scattered over 40 x 40 km
+    const size_t count = 500;
+    std::vector<EnuState> truth(count);
+    for (size_t i = 0; i < count; ++i) {
+        CounterRng rng(3, static_cast<uint32_t>(i), 0, CounterRng::Stream::TRACK_SPAWN);
+        const double heading = rng.uniform(0.0, 2.0 * M_PI);
+        const double speed = rng.uniform(100.0, 300.0);
+        truth[i] = {rng.uniform(-20000.0, 20000.0), rng.uniform(-20000.0, 20000.0),
+                    rng.uniform(500.0, 5000.0), speed * std::sin(heading),
+                    speed * std::cos(heading), 0.0};
+    }
+
+    TrackerConfig config;
+    config.routing = PlotRouting::ASSOCIATION;
+    TrackerBank bank(config);
+
+    std::vector<Measurement> plots(count);
+    size_t assigned = 0;
+    for (int scan = 0; scan < 30; ++scan) {
+        for (size_t i = 0; i < count; ++i) {
+            // Raw plots: no track id for the bank to rely on
+            Track track;
+            common::toSpherical(truth[i], track);
+            CounterRng rng(4, static_cast<uint32_t>(i), scan, CounterRng::Stream::MEASUREMENT);
+            plots[i].track_id = 0;
+            plots[i].range_m = track.range_m + config.range_sigma_m * rng.gaussian();
+            plots[i].azimuth_rad = track.azimuth_rad + config.azimuth_sigma_rad * rng.gaussian();
+            plots[i].elevation_rad = track.elevation_rad + config.elevation_sigma_rad * rng.gaussian();
+        }
+        bank.processScan(plots, scan * 0.1);
+        assigned += bank.getAssociationStats().assigned;
+        for (auto& state : truth) {
+            motion::advanceLinear(state, 0.1);
+        }
+    }
+    // The 99.9% gate loses a true plot now and then; the filter coasts
+    // over it while the stray plot's tentative filter may briefly confirm
+    assert(assigned >= count * 29 * 99 / 100 && "Filters take their plots");
+
+    // Every target is followed by one confirmed filter, with few duplicates
+    TrackSpan tracks = bank.getTracks();
+    assert(tracks.size() >= count && tracks.size() <= count + count / 100 &&
+           "One confirmed filter per target");
+    PositionSet truth_set, track_set;
+    truth_set.resize(count);
+    track_set.resize(tracks.size());
+    for (size_t i = 0; i < count; ++i) {
+        setDiagonal(truth_set, i, truth[i].east_m, truth[i].north_m, truth[i].up_m, 1.0);
+    }
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        const EnuState enu = common::toEnu(tracks[i]);
+        setDiagonal(track_set, i, enu.east_m, enu.north_m, enu.up_m, 1.0);
+    }
+    AssociatorConfig match_config;
+    // Within 250 m: cross-range plot noise reaches 100 m (1 sigma) at 28 km
+    match_config.gate_chi2 = 250.0 * 250.0 / 2.0;
+    PlotAssociator matcher(match_config);
+    std::vector<uint32_t> match;
+    matcher.associate(truth_set, track_set, match);
+    assert(matcher.getStats().assigned == count && "Every target has a filter within 250 m");
+
+    std::cout << "    ✓ " << tracks.size() << " targets tracked from raw plots\n";
+    std::cout << "  ✓ Association tracking test passed\n";
+}
+
+// Benchmark: association time against track count (one plot per track,
+// constant density). Compare with the 100 ms cycle budget.
+void benchmark_association_scaling() {
+    std::cout << "  Benchmarking association time vs track count...\n";
+    std::cout << "    tracks   gated pairs   bids      time (ms)   per track (us)\n";
+
+    PlotAssociator associator;
+    const size_t counts[] = {1000, 2000, 5000, 10000, 20000, 50000};
+    for (size_t count : counts) {
+        // Constant density: ~1 target per km^2
+        const double extent_m = 500.0 * std::sqrt(static_cast<double>(count));
+        PositionSet tracks, plots;
+        std::vector<uint32_t> truth, result;
+        makeScene(count, extent_m, count, tracks, plots, truth);
+
+        associator.associate(tracks, plots, result); // Warm up the buffers
+        auto start = std::chrono::steady_clock::now();
+        associator.associate(tracks, plots, result);
+        auto end = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        size_t correct = 0;
+        for (size_t t = 0; t < count; ++t) {
+            correct += result[t] == truth[t];
+        }
+        assert(correct >= count * 99 / 100 && "Isolated targets take their own plot");
+
+        const AssociationStats& stats = associator.getStats();
+        std::cout << "    " << std::setw(6) << count << "   " << std::setw(11) << stats.gated_pairs
+                  << "   " << std::setw(7) << stats.bids << "   " << std::setw(9)
+                  << std::fixed << std::setprecision(2) << ms << "   " << std::setw(14)
+                  << ms * 1000.0 / count << "\n";
+        std::cout.unsetf(std::ios::fixed);
+    }
+
+    std::cout << "  ✓ Association benchmark complete\n";
+}
+
+int main() {
+    std::cout << "Running plot association tests...\n";
+
+    test_grid_gating();
+    test_auction_optimality();
+    test_association_tracking();
+    benchmark_association_scaling();
+
+    std::cout << "All plot association tests passed!\n";
+    return 0;
+}
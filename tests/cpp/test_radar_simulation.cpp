@@ -2,19 +2,36 @@
 #include <cassert>
 #include <cmath>
 #include <vector>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "common/sim_clock.hpp"
+#include "radar_simulator/counter_rng.hpp"
+#include "radar_simulator/motion_kernels.hpp"
 #include "radar_simulator/radar_simulator.hpp"
 #include "radar_simulator/scenario_manager.hpp"
+#include "radar_simulator/sensor_model.hpp"
+#include "radar_simulator/track_recording.hpp"
 #include "radar_simulator/track_state.hpp"
+#include "radar_simulator/track_store.hpp"
+#include "radar_simulator/trajectory_table.hpp"
+#include "radar_simulator/worker_pool.hpp"
 #include "c2_controller/threat_evaluator.hpp"
 
 using namespace skyguardis::radar;
 using namespace skyguardis::c2;
+namespace common = skyguardis::common;
 
 // Test: Track persistence across cycles
 void test_track_persistence() {
     std::cout << "  Testing track persistence...\n";
     
+    // Fixed seed: an unlucky random track can leave the zone within a second
     RadarSimulator radar;
+    radar.setRandomSeed(1);
     radar.setScenario(ScenarioType::SINGLE_TARGET);
     radar.generateTracks();
     
@@ -168,6 +185,71 @@ void test_saturation_scenario() {
     std::cout << "  ✓ Saturation scenario test passed\n";
 }
 
+// Test: Mass raid scenario (staged waves beyond the saturation cap)
+void test_mass_raid_scenario() {
+    std::cout << "  Testing mass raid scenario...\n";
+    
+    // Count clamping
+    ScenarioManager manager;
+    ScenarioConfig config;
+    config.target_count = 10;
+    manager.setScenario(ScenarioType::MASS_RAID, config);
+    assert(manager.getConfig().target_count == MASS_RAID_MIN_TARGETS && "Mass raid count clamped up");
+    config.target_count = 5000000;
+    manager.setScenario(ScenarioType::MASS_RAID, config);
+    assert(manager.getConfig().target_count == MASS_RAID_MAX_TARGETS && "Mass raid count clamped down");
+    
+    // 3 waves of 1000, opening every 2 s, each released at 500 tracks/s.
+    // Wide bounds so no track leaves during the test.
+    config.target_count = 3000;
+    config.wave_count = 3;
+    config.wave_interval_s = 2.0;
+    config.spawn_rate_per_s = 500.0;
+    config.detection_zone_radius_m = 1.0e7;
+    config.min_range_m = 1000.0;
+    config.max_range_m = 10000.0;
+    config.min_elevation_rad = -1.6;
+    config.max_elevation_rad = 1.6;
+    
+    RadarSimulator radar;
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+    assert(radar.getActiveTrackCount() == 0 && "Rate-limited wave starts empty");
+    
+    // Count releases rather than live tracks: some leave through min_range_m
+    radar.updateTracks(0.1);
+    assert(radar.getCycleStats().tracks_spawned == 50 && "0.1 s at 500/s releases 50 tracks");
+    
+    for (int i = 0; i < 19; ++i) radar.updateTracks(0.1); // t = 2.0 s
+    assert(radar.getCycleStats().tracks_spawned == 1000 && "First wave fully released");
+    
+    for (int i = 0; i < 10; ++i) radar.updateTracks(0.1); // t = 3.0 s
+    assert(radar.getCycleStats().tracks_spawned == 1500 && "Second wave half released");
+    
+    for (int i = 0; i < 30; ++i) radar.updateTracks(0.1); // t = 6.0 s
+    assert(radar.getCycleStats().tracks_spawned == 3000 && "All waves released");
+    
+    CycleStats stats = radar.getCycleStats();
+    assert(stats.cycles == 60 && stats.tracks_spawned == 3000 && "Cycle stats recorded");
+    assert(stats.max_update_ms >= stats.meanUpdateMs() && "Max cycle time bounds the mean");
+    
+    std::cout << "    ✓ Staged waves released " << stats.tracks_spawned << " tracks, mean cycle "
+              << stats.meanUpdateMs() << "ms, max " << stats.max_update_ms << "ms\n";
+    
+    // Instant waves: 100k tracks arrive at once and update within a cycle
+    config.target_count = 100000;
+    config.wave_count = 1;
+    config.spawn_rate_per_s = 0.0;
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+    assert(radar.getActiveTrackCount() == 100000 && "Instant wave releases all tracks");
+    radar.updateTracks(0.1);
+    stats = radar.getCycleStats();
+    assert(stats.cycles == 1 && stats.tracks_spawned == 100000 && "Stats reset per scenario");
+    assert(stats.last_track_count == radar.getActiveTrackCount() && "Track count reported");
+    
+    std::cout << "    ✓ 100k-track cycle took " << stats.last_update_ms << "ms\n";
+    std::cout << "  ✓ Mass raid scenario test passed\n";
+}
+
 // Test: Track lifecycle - creation
 void test_track_creation() {
     std::cout << "  Testing track creation...\n";
@@ -266,6 +348,31 @@ void test_track_history() {
     std::cout << "  ✓ Track history test passed\n";
 }
 
+// Test: History ring buffer wraparound
+void test_track_history_ring_buffer() {
+    std::cout << "  Testing track history ring buffer...\n";
+    
+    TrackHistory history;
+    const size_t pushes = TrackState::MAX_HISTORY + 5;
+    for (size_t i = 0; i < pushes; ++i) {
+        Track t{};
+        t.id = static_cast<uint32_t>(i);
+        history.push_back(t);
+    }
+    
+    assert(history.size() == TrackState::MAX_HISTORY && "History should be capped");
+    assert(history.front().id == pushes - TrackState::MAX_HISTORY && "Oldest entries should be dropped");
+    assert(history.back().id == pushes - 1 && "Newest entry should be last");
+    
+    uint32_t expected = static_cast<uint32_t>(pushes - TrackState::MAX_HISTORY);
+    for (const auto& entry : history) {
+        assert(entry.id == expected++ && "Iteration should run oldest to newest");
+    }
+    
+    std::cout << "    ✓ Oldest: " << history.front().id << ", newest: " << history.back().id << "\n";
+    std::cout << "  ✓ Track history ring buffer test passed\n";
+}
+
 // Test: Velocity constraints
 void test_velocity_constraints() {
     std::cout << "  Testing velocity constraints...\n";
@@ -284,8 +391,9 @@ void test_velocity_constraints() {
     // Apply motion for 1 second - should be constrained
     manager.applyMotionModel(track, 1.0);
     
-    assert(track.track.velocity_ms <= 500.0 && "Velocity should be constrained to max");
-    assert(track.track.velocity_ms >= 50.0 && "Velocity should be constrained to min");
+    // Speed is derived from the velocity vector, so allow rounding
+    assert(track.track.velocity_ms <= 500.0 + 1e-9 && "Velocity should be constrained to max");
+    assert(track.track.velocity_ms >= 50.0 - 1e-9 && "Velocity should be constrained to min");
     
     std::cout << "    ✓ Velocity constrained to: " << track.track.velocity_ms << "m/s\n";
     std::cout << "  ✓ Velocity constraints test passed\n";
@@ -428,6 +536,906 @@ void test_active_track_counting() {
     std::cout << "  ✓ Active track counting test passed\n";
 }
 
+// Test: Columnar track store
+void test_track_store() {
+    std::cout << "  Testing columnar track store...\n";
+    
+    ScenarioManager manager;
+    ScenarioConfig config;
+    config.target_count = 8;
+    manager.setScenario(ScenarioType::SWARM, config);
+    
+    TrackStore store;
+    manager.generateInitialTracks(store);
+    assert(store.size() == 8 && "Store should hold all initial tracks");
+    assert(store.activeCount() == store.size() && "All initial tracks should be active");
+    
+    // Row round trip through the columns
+    TrackState state = store.get(3);
+    state.track.range_m = 4321.0;
+    store.set(3, state);
+    assert(std::abs(store.track(3).range_m - 4321.0) < 1e-6 && "Scatter should write the columns");
+    assert(store.track(3).id == state.track.id && "Gather should read the same row");
+    
+    // Removal keeps the survivors and their ids reachable
+    uint32_t first_id = store.id[0];
+    uint32_t last_id = store.id[7];
+    for (size_t i = 1; i <= 2; ++i) {
+        TrackState far = store.get(i);
+        far.track.range_m = 1.0e6; // Out of bounds
+        store.set(i, far);
+    }
+    manager.removeOutOfBoundsTracks(store);
+    assert(store.size() == 6 && "Out-of-bounds rows should be removed");
+    size_t found = 0;
+    assert(store.id[0] == first_id && "Rows before the first hole stay put");
+    if (!store.find(last_id, found) || store.id[found] != last_id) {
+        throw std::runtime_error("Moved row found by id");
+    }
+    
+    // Update pass ages tracks and records history
+    manager.updateTracks(store, 0.1);
+    assert(store.age_cycles[0] == 1 && "Track age should increase");
+    assert(store.history[0].size() == 1 && "History should be recorded");
+    
+    std::cout << "    ✓ Store size after update: " << store.size() << "\n";
+    std::cout << "  ✓ Track store test passed\n";
+}
+
+// Test: Slot map handles and swap-and-pop removal
+void test_track_store_handles() {
+    std::cout << "  Testing track store handles...\n";
+    
+    TrackStore store;
+    std::vector<TrackHandle> handles;
+    for (uint32_t i = 0; i < 100; ++i) {
+        TrackState state;
+        state.track.id = 1000 + i;
+        state.track.range_m = 5000.0;
+        state.track.azimuth_rad = 0.0;
+        state.track.elevation_rad = 0.0;
+        state.track.velocity_ms = 100.0;
+        state.track.heading_rad = 0.0;
+        handles.push_back(store.push_back(state));
+    }
+    
+    // Removing a row moves the last one into its place; handles follow it
+    size_t index = 0;
+    store.remove(10);
+    assert(store.size() == 99 && "Row removed");
+    if (store.resolve(handles[10], index)) {
+        throw std::runtime_error("Removed track's handle is stale");
+    }
+    if (store.find(1010, index)) {
+        throw std::runtime_error("Removed id no longer found");
+    }
+    if (!store.resolve(handles[99], index) || index != 10) {
+        throw std::runtime_error("Last row moved into the hole");
+    }
+    if (!store.find(1099, index) || index != 10) {
+        throw std::runtime_error("Id lookup follows the move");
+    }
+    
+    // Keep every third row
+    std::vector<uint8_t> keep(store.size());
+    for (size_t i = 0; i < keep.size(); ++i) {
+        keep[i] = (store.id[i] % 3 == 0) ? 1 : 0;
+    }
+    store.retain(keep);
+    for (uint32_t i = 0; i < 100; ++i) {
+        const uint32_t track_id = 1000 + i;
+        const bool expected = (track_id % 3 == 0) && i != 10;
+        bool by_id = store.find(track_id, index);
+        assert(by_id == expected && "Id lookup matches retained rows");
+        if (by_id) {
+            assert(store.id[index] == track_id && "Id lookup returns the right row");
+            size_t by_handle = 0;
+            if (!store.resolve(handles[i], by_handle) || by_handle != index) {
+                throw std::runtime_error("Handle resolves to the same row");
+            }
+        }
+    }
+    
+    // Freed slots are recycled with a new generation
+    TrackState late;
+    late.track.id = 5000;
+    late.track.range_m = 5000.0;
+    late.track.velocity_ms = 100.0;
+    TrackHandle reused = store.push_back(late);
+    if (reused.slot != handles[10].slot && store.resolve(handles[10], index)) {
+        throw std::runtime_error("Old handle stays stale");
+    }
+    if (!store.resolve(reused, index) || store.id[index] != 5000) {
+        throw std::runtime_error("New handle resolves");
+    }
+    
+    // Clearing invalidates everything
+    store.clear();
+    if (store.resolve(reused, index) || store.find(5000, index)) {
+        throw std::runtime_error("Clear drops all tracks");
+    }
+    
+    // High churn: removal cost does not depend on the number of survivors
+    const size_t big = 200000;
+    TrackStore churn;
+    churn.reserve(big);
+    for (uint32_t i = 0; i < big; ++i) {
+        late.track.id = i + 1;
+        churn.push_back(late);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < 1000; ++i) {
+        churn.remove(i * 97 % churn.size());
+    }
+    auto elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    assert(churn.size() == big - 1000 && "Churn removals applied");
+    
+    // Simulator-level lookup by id
+    RadarSimulator radar;
+    radar.setRandomSeed(11);
+    radar.setScenario(ScenarioType::SATURATION);
+    auto tracks = radar.getCurrentTracks();
+    Track looked_up = Track();
+    if (!radar.findTrack(tracks.back().id, looked_up)) {
+        throw std::runtime_error("Live track found");
+    }
+    assert(looked_up.range_m == tracks.back().range_m && "Lookup returns current state");
+    if (radar.findTrack(999999, looked_up)) {
+        throw std::runtime_error("Unknown id not found");
+    }
+    
+    std::cout << "    ✓ 1000 removals from " << big << " tracks in " << elapsed_ms << "ms\n";
+    std::cout << "  ✓ Track store handles test passed\n";
+}
+
+// Test: Batch motion kernels agree with the scalar path
+void test_batch_motion_kernels() {
+    std::cout << "  Testing batch motion kernels...\n";
+    
+    const size_t count = 1003; // Not a multiple of the vector width
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> position_dist(-15000.0, 15000.0);
+    std::uniform_real_distribution<double> speed_dist(-300.0, 300.0);
+    std::uniform_real_distribution<double> accel_dist(-50.0, 50.0);
+    std::uniform_real_distribution<double> turn_dist(-0.5, 0.5);
+    
+    std::vector<EnuState> start(count);
+    std::vector<double> accel(count), turn(count);
+    std::vector<uint8_t> mask(count);
+    for (size_t i = 0; i < count; ++i) {
+        start[i].east_m = position_dist(rng);
+        start[i].north_m = position_dist(rng);
+        start[i].up_m = position_dist(rng) / 10.0;
+        start[i].vel_east_ms = speed_dist(rng);
+        start[i].vel_north_ms = speed_dist(rng);
+        start[i].vel_up_ms = speed_dist(rng) / 10.0;
+        accel[i] = accel_dist(rng);
+        turn[i] = turn_dist(rng);
+        mask[i] = (i % 3 != 0) ? 1 : 0;
+    }
+    
+    // Scalar reference
+    std::vector<EnuState> ref = start;
+    const int steps = 50;
+    for (int step = 0; step < steps; ++step) {
+        for (size_t i = 0; i < count; ++i) {
+            if (!mask[i]) continue;
+            motion::advanceManeuver(ref[i], accel[i], turn[i], 0.1);
+            motion::advanceLinear(ref[i], 0.1);
+        }
+    }
+    
+    const common::KernelIsa isas[] = {common::KernelIsa::SCALAR, common::KernelIsa::SSE41,
+                                      common::KernelIsa::AVX2};
+    for (auto isa : isas) {
+        common::setKernelIsa(isa);
+        std::vector<double> e(count), n(count), u(count), ve(count), vn(count), vu(count);
+        for (size_t i = 0; i < count; ++i) {
+            e[i] = start[i].east_m;
+            n[i] = start[i].north_m;
+            u[i] = start[i].up_m;
+            ve[i] = start[i].vel_east_ms;
+            vn[i] = start[i].vel_north_ms;
+            vu[i] = start[i].vel_up_ms;
+        }
+        for (int step = 0; step < steps; ++step) {
+            motion::advanceManeuverBatch(ve.data(), vn.data(), vu.data(), accel.data(), turn.data(),
+                                         mask.data(), count, 0.1);
+            motion::advanceLinearBatch(e.data(), n.data(), u.data(), ve.data(), vn.data(), vu.data(),
+                                       mask.data(), count, 0.1);
+        }
+        
+        double max_error = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!mask[i]) {
+                assert(e[i] == start[i].east_m && ve[i] == start[i].vel_east_ms &&
+                       "Masked tracks must not move");
+                continue;
+            }
+            max_error = std::max(max_error, std::abs(e[i] - ref[i].east_m));
+            max_error = std::max(max_error, std::abs(n[i] - ref[i].north_m));
+            max_error = std::max(max_error, std::abs(u[i] - ref[i].up_m));
+            max_error = std::max(max_error, std::abs(ve[i] - ref[i].vel_east_ms));
+            max_error = std::max(max_error, std::abs(vn[i] - ref[i].vel_north_ms));
+            max_error = std::max(max_error, std::abs(vu[i] - ref[i].vel_up_ms));
+        }
+        assert(max_error < 1e-6 && "Batch kernel should match scalar path");
+        
+        std::cout << "    ✓ " << common::kernelIsaName(common::getKernelIsa())
+                  << " max deviation: " << max_error << "m\n";
+    }
+    
+    // Throughput: one 100 ms cycle worth of updates for 100k tracks
+    common::setKernelIsa(common::detectKernelIsa());
+    const size_t big = 100000;
+    std::vector<double> e(big, 3000.0), n(big, 4000.0), u(big, 500.0);
+    std::vector<double> ve(big, -150.0), vn(big, -200.0), vu(big, 0.0);
+    std::vector<double> ac(big, 5.0), w(big, 0.05);
+    auto start_time = std::chrono::steady_clock::now();
+    motion::advanceManeuverBatch(ve.data(), vn.data(), vu.data(), ac.data(), w.data(), nullptr, big, 0.1);
+    motion::advanceLinearBatch(e.data(), n.data(), u.data(), ve.data(), vn.data(), vu.data(),
+                               nullptr, big, 0.1);
+    auto elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start_time).count();
+    assert(elapsed_ms < 100.0 && "100k tracks should advance within one cycle");
+    
+    std::cout << "    ✓ 100k tracks advanced in " << elapsed_ms << "ms ("
+              << common::kernelIsaName(common::getKernelIsa()) << ")\n";
+    std::cout << "  ✓ Batch motion kernels test passed\n";
+}
+
+// Test: Cartesian propagation and lazy spherical conversion
+void test_cartesian_propagation() {
+    std::cout << "  Testing Cartesian propagation...\n";
+    
+    // Spherical -> ENU -> spherical round trip
+    Track report;
+    report.id = 7;
+    report.range_m = 12000.0;
+    report.azimuth_rad = -2.5;
+    report.elevation_rad = 0.3;
+    report.velocity_ms = 240.0;
+    report.heading_rad = 1.2;
+    EnuState state = common::toEnu(report);
+    Track back;
+    back.id = report.id;
+    common::toSpherical(state, back);
+    assert(std::abs(back.range_m - report.range_m) < 1e-6 && "Range round trip");
+    assert(std::abs(back.azimuth_rad - report.azimuth_rad) < 1e-12 && "Azimuth round trip");
+    assert(std::abs(back.elevation_rad - report.elevation_rad) < 1e-12 && "Elevation round trip");
+    assert(std::abs(back.velocity_ms - report.velocity_ms) < 1e-9 && "Speed round trip");
+    assert(std::abs(back.heading_rad - report.heading_rad) < 1e-12 && "Heading round trip");
+    
+    // Straight pass: a target due north at 10 km flying east at 200 m/s.
+    // After an hour of 10 Hz steps the geometry must match the closed form.
+    TrackState row;
+    row.track.id = 1;
+    row.track.range_m = 10000.0;
+    row.track.azimuth_rad = 0.0;
+    row.track.elevation_rad = 0.0;
+    row.track.velocity_ms = 200.0;
+    row.track.heading_rad = 1.5707963267948966; // East
+    TrackStore store;
+    store.push_back(row);
+    
+    const int steps = 36000;
+    for (int step = 0; step < steps; ++step) {
+        motion::advanceLinearBatch(store.east_m.data(), store.north_m.data(), store.up_m.data(),
+                                   store.vel_east_ms.data(), store.vel_north_ms.data(),
+                                   store.vel_up_ms.data(), nullptr, store.size(), 0.1);
+    }
+    const double travelled_m = 200.0 * steps * 0.1;
+    const Track moved = store.track(0);
+    assert(std::abs(moved.range_m - std::hypot(10000.0, travelled_m)) < 1e-3 &&
+           "Range follows straight-line geometry");
+    assert(std::abs(moved.azimuth_rad - std::atan2(travelled_m, 10000.0)) < 1e-9 &&
+           "Azimuth follows straight-line geometry");
+    assert(std::abs(moved.heading_rad - row.track.heading_rad) < 1e-12 && "Heading unchanged");
+    assert(std::abs(moved.velocity_ms - 200.0) < 1e-9 && "Speed unchanged");
+    
+    // A full turn at constant speed returns to the starting heading
+    EnuState turning = common::toEnu(row.track);
+    const double turn_rate = 0.1;
+    const int turn_steps = static_cast<int>(std::round(2.0 * 3.14159265358979 / (turn_rate * 0.01)));
+    for (int step = 0; step < turn_steps; ++step) {
+        motion::advanceManeuver(turning, 0.0, turn_rate, 0.01);
+    }
+    Track turned;
+    common::toSpherical(turning, turned);
+    assert(std::abs(turned.velocity_ms - 200.0) < 1e-6 && "Turning keeps speed");
+    assert(std::abs(std::remainder(turned.heading_rad - row.track.heading_rad, 2.0 * 3.14159265358979)) < 1e-3 &&
+           "Full turn restores heading");
+    
+    std::cout << "    ✓ 1 hour straight pass: range " << moved.range_m << "m (error "
+              << std::abs(moved.range_m - std::hypot(10000.0, travelled_m)) << "m)\n";
+    std::cout << "  ✓ Cartesian propagation test passed\n";
+}
+
+// Test: Parallel columnar update matches the serial path
+void test_parallel_update() {
+    std::cout << "  Testing parallel track update...\n";
+    
+    ScenarioConfig config;
+    config.target_count = 20000;
+    config.wave_count = 2;
+    config.wave_interval_s = 1.0;
+    config.spawn_rate_per_s = 20000.0;
+    
+    // Same seed, serial vs 4 workers; tracks leave and spawn along the way
+    ScenarioManager serial, parallel;
+    serial.setRandomSeed(1234);
+    parallel.setRandomSeed(1234);
+    parallel.setWorkerCount(4);
+    assert(parallel.getWorkerCount() == 4 && "Worker count applied");
+    serial.setScenario(ScenarioType::MASS_RAID, config);
+    parallel.setScenario(ScenarioType::MASS_RAID, config);
+    
+    TrackStore serial_store, parallel_store;
+    serial.generateInitialTracks(serial_store);
+    parallel.generateInitialTracks(parallel_store);
+    
+    for (int cycle = 0; cycle < 40; ++cycle) {
+        serial.updateTracks(serial_store, 0.1);
+        parallel.updateTracks(parallel_store, 0.1);
+    }
+    
+    assert(serial_store.size() == parallel_store.size() && "Same surviving track count");
+    assert(serial_store.size() > ScenarioManager::UPDATE_BLOCK_SIZE && "Spans several blocks");
+    for (size_t i = 0; i < serial_store.size(); ++i) {
+        assert(serial_store.id[i] == parallel_store.id[i]);
+        assert(serial_store.east_m[i] == parallel_store.east_m[i]);
+        assert(serial_store.north_m[i] == parallel_store.north_m[i]);
+        assert(serial_store.vel_east_ms[i] == parallel_store.vel_east_ms[i]);
+        assert(serial_store.acceleration_ms2[i] == parallel_store.acceleration_ms2[i]);
+        assert(serial_store.history[i].size() == parallel_store.history[i].size());
+    }
+    
+    std::cout << "    ✓ " << serial_store.size() << " tracks identical after 40 cycles (serial "
+              << serial.getCycleStats().meanUpdateMs() << "ms, 4 workers "
+              << parallel.getCycleStats().meanUpdateMs() << "ms per cycle)\n";
+    
+    // Pool reuse across many small jobs
+    WorkerPool pool(3);
+    std::vector<int> hits(1000, 0);
+    for (int round = 0; round < 50; ++round) {
+        pool.parallelFor(hits.size(), [&](size_t i) { hits[i]++; });
+    }
+    for (int h : hits) {
+        assert(h == 50 && "Every task runs exactly once per job");
+    }
+    
+    std::cout << "  ✓ Parallel track update test passed\n";
+}
+
+// Test: Columnar update bucketed by motion model matches the row path
+void test_motion_model_buckets() {
+    std::cout << "  Testing motion model buckets...\n";
+    
+    ScenarioConfig config;
+    config.target_count = 20000;
+    config.wave_count = 1;
+    config.spawn_rate_per_s = 0.0;
+    ScenarioManager generator;
+    generator.setRandomSeed(77);
+    generator.setScenario(ScenarioType::MASS_RAID, config);
+    TrackStore store;
+    generator.generateInitialTracks(store);
+    
+    std::vector<TrackState> rows;
+    std::vector<double> acceleration_before;
+    for (size_t i = 0; i < store.size(); ++i) {
+        rows.push_back(store.get(i));
+        acceleration_before.push_back(store.acceleration_ms2[i]);
+    }
+    const TrackHandle handle = store.handle(store.size() - 1);
+    const uint32_t handle_id = store.id[store.size() - 1];
+    
+    // One cycle through both paths with the same seed and cycle
+    ScenarioManager bucketed, reference;
+    bucketed.setRandomSeed(77);
+    reference.setRandomSeed(77);
+    bucketed.applyMotionModel(store, 0.1);
+    for (auto& row : rows) {
+        reference.applyMotionModel(row, 0.1);
+    }
+    
+    // Maneuvering rows come first, and handles follow their tracks
+    size_t maneuvering = 0;
+    while (maneuvering < store.size() && store.motion_model[maneuvering] == MotionModel::MANEUVERING) {
+        ++maneuvering;
+    }
+    for (size_t i = maneuvering; i < store.size(); ++i) {
+        assert(store.motion_model[i] == MotionModel::LINEAR && "Rows bucketed by motion model");
+    }
+    assert(maneuvering > 0 && maneuvering < store.size() && "Both buckets populated");
+    size_t row = 0;
+    if (!store.resolve(handle, row) || store.id[row] != handle_id) {
+        throw std::runtime_error("Handle follows its row");
+    }
+    
+    // Same kinematics and the same maneuver changes as the per-track switch
+    size_t changed = 0;
+    for (size_t r = 0; r < rows.size(); ++r) {
+        const TrackState& expected = rows[r];
+        size_t index = 0;
+        if (!store.find(expected.track.id, index)) {
+            throw std::runtime_error("Track still in the store");
+        }
+        const Track moved = store.track(index);
+        assert(std::abs(moved.range_m - expected.track.range_m) < 1e-6 && "Range matches row path");
+        assert(std::abs(moved.azimuth_rad - expected.track.azimuth_rad) < 1e-9 && "Azimuth matches row path");
+        assert(std::abs(moved.velocity_ms - expected.track.velocity_ms) < 1e-6 && "Speed matches row path");
+        assert(std::abs(std::remainder(moved.heading_rad - expected.track.heading_rad, 6.283185307179586)) < 1e-9 &&
+               "Heading matches row path");
+        assert(store.acceleration_ms2[index] == expected.acceleration_ms2 && "Same acceleration draw");
+        assert(store.angular_velocity_rads[index] == expected.angular_velocity_rads && "Same turn rate draw");
+        changed += expected.acceleration_ms2 != acceleration_before[r];
+    }
+    const double change_rate = static_cast<double>(changed) / maneuvering;
+    assert(change_rate > 0.03 && change_rate < 0.07 && "About 5% of maneuvers change per cycle");
+    
+    // Later cycles find the buckets already in place
+    auto start = std::chrono::steady_clock::now();
+    bucketed.applyMotionModel(store, 0.1);
+    double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << "    ✓ " << maneuvering << " maneuvering and " << store.size() - maneuvering
+              << " linear tracks in " << elapsed_ms * 1e6 / store.size() << "ns per track\n";
+    std::cout << "  ✓ Motion model buckets test passed\n";
+}
+
+// Test: Counter-based RNG and reproducible scenarios
+void test_counter_rng() {
+    std::cout << "  Testing counter-based RNG...\n";
+    
+    // Philox4x32-10 known-answer vectors (Random123)
+    CounterRng::Block zero = CounterRng::philox({0, 0, 0, 0}, {0, 0});
+    assert(zero[0] == 0x6627e8d5u && zero[1] == 0xe169c58du &&
+           zero[2] == 0xbc57ac4cu && zero[3] == 0x9b00dbd8u && "Philox KAT (zero)");
+    CounterRng::Block pi = CounterRng::philox({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                                              {0xa4093822u, 0x299f31d0u});
+    assert(pi[0] == 0xd16cfe09u && pi[1] == 0x94fdccebu &&
+           pi[2] == 0x5001e420u && pi[3] == 0x24126ea1u && "Philox KAT (pi)");
+    
+    // Draws depend only on the key, and distinct keys give distinct streams
+    CounterRng a(7, 42, 3, CounterRng::Stream::MANEUVER);
+    CounterRng b(7, 42, 3, CounterRng::Stream::MANEUVER);
+    CounterRng c(7, 42, 4, CounterRng::Stream::MANEUVER);
+    CounterRng d(7, 42, 3, CounterRng::Stream::TRACK_SPAWN);
+    bool differs_cycle = false, differs_stream = false;
+    double sum = 0.0;
+    for (int i = 0; i < 10000; ++i) {
+        double x = a.uniform();
+        assert(x == b.uniform() && "Same key reproduces the stream");
+        assert(x >= 0.0 && x < 1.0 && "Uniform draws in [0, 1)");
+        differs_cycle |= x != c.uniform();
+        differs_stream |= x != d.uniform();
+        sum += x;
+    }
+    assert(differs_cycle && differs_stream && "Different keys give different streams");
+    assert(std::abs(sum / 10000.0 - 0.5) < 0.02 && "Uniform mean near 0.5");
+    
+    // Two simulators with the same seed replay the same run
+    ScenarioConfig config;
+    config.target_count = 10;
+    RadarSimulator first, second;
+    first.setRandomSeed(99);
+    second.setRandomSeed(99);
+    first.setScenario(ScenarioType::SATURATION, config);
+    second.setScenario(ScenarioType::SATURATION, config);
+    for (int cycle = 0; cycle < 100; ++cycle) {
+        first.updateTracks(0.1);
+        second.updateTracks(0.1);
+    }
+    auto first_tracks = first.getCurrentTracks();
+    auto second_tracks = second.getCurrentTracks();
+    assert(first_tracks.size() == second_tracks.size() && "Same track count");
+    for (size_t i = 0; i < first_tracks.size(); ++i) {
+        assert(first_tracks[i].id == second_tracks[i].id);
+        assert(first_tracks[i].range_m == second_tracks[i].range_m);
+        assert(first_tracks[i].heading_rad == second_tracks[i].heading_rad);
+    }
+    
+    std::cout << "    ✓ Seeded run replayed " << first_tracks.size() << " tracks after 100 cycles\n";
+    std::cout << "  ✓ Counter-based RNG test passed\n";
+}
+
+// Test: Radar simulator driven by a virtual clock
+void test_virtual_clock() {
+    std::cout << "  Testing virtual clock...\n";
+    
+    skyguardis::common::VirtualClock clock(1000.0);
+    RadarSimulator radar;
+    radar.setClock(&clock);
+    radar.setRandomSeed(5);
+    radar.setScenario(ScenarioType::SINGLE_TARGET);
+    
+    const TrackStore& store = radar.getTrackStore();
+    assert(store.entry_time_s[0] == 1000.0 && "Entry time comes from the injected clock");
+    
+    // Ten minutes of 10 Hz cycles with delta taken from the clock
+    const double start_range = store.track(0).range_m;
+    auto start = std::chrono::steady_clock::now();
+    for (int cycle = 0; cycle < 6000 && store.size() > 0; ++cycle) {
+        clock.sleepFor(0.1);
+        radar.updateTracks(0.0);
+    }
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assert(clock.now() >= 1000.0 + 599.9 && "Ten simulated minutes passed");
+    assert(elapsed_s < 10.0 && "Virtual time runs faster than real time");
+    if (store.size() > 0 && store.id[0] == 1) {
+        assert(store.track(0).range_m != start_range && "Track moved with clock deltas");
+        assert(std::abs(store.last_update_time_s[0] - clock.now()) < 1e-9 && "Timestamps follow clock");
+    }
+    
+    std::cout << "    ✓ 600 simulated seconds in " << elapsed_s * 1000.0 << "ms\n";
+    std::cout << "  ✓ Virtual clock test passed\n";
+}
+
+// Test: Recording and memory-mapped replay
+void test_recording_replay() {
+    std::cout << "  Testing recording and replay...\n";
+    
+    const std::string path = "/tmp/test_radar_recording.skyrec";
+    ScenarioConfig config;
+    config.target_count = 15;
+    
+    RadarSimulator radar;
+    radar.setRandomSeed(11);
+    radar.setScenario(ScenarioType::SATURATION, config);
+    bool recording = radar.startRecording(path);
+    assert(recording && "Recording opens");
+    
+    std::vector<std::vector<Track>> expected;
+    for (int cycle = 0; cycle < 50; ++cycle) {
+        radar.updateTracks(0.1);
+        expected.push_back(radar.getCurrentTracks());
+    }
+    bool closed = radar.stopRecording();
+    assert(closed && "Recording closes");
+    assert(!radar.isRecording());
+    
+    TrackReplay replay;
+    bool mapped = replay.open(path);
+    assert(mapped && "Recording maps");
+    assert(replay.frameCount() == expected.size() && "One frame per cycle");
+    for (size_t f = 0; f < expected.size(); ++f) {
+        FrameView frame = replay.frame(f);
+        assert(frame.cycle == f + 1 && "Frames carry their cycle number");
+        assert(frame.size() == expected[f].size() && "Frame holds every active track");
+        for (size_t i = 0; i < frame.size(); ++i) {
+            assert(frame[i].id == expected[f][i].id);
+            assert(frame[i].range_m == expected[f][i].range_m);
+            assert(frame[i].heading_rad == expected[f][i].heading_rad);
+        }
+    }
+    assert(replay.frame(expected.size()).empty() && "Out-of-range frame is empty");
+    
+    // Truncated files are rejected
+    {
+        std::ofstream truncated("/tmp/test_radar_recording_truncated.skyrec", std::ios::binary);
+        truncated.write("SKYREC01", 8);
+    }
+    TrackReplay bad;
+    bool truncated_opened = bad.open("/tmp/test_radar_recording_truncated.skyrec");
+    bool missing_opened = bad.open("/tmp/does_not_exist.skyrec");
+    assert(!truncated_opened && "Truncated file rejected");
+    assert(!missing_opened && "Missing file rejected");
+    
+    std::cout << "    ✓ Replayed " << replay.frameCount() << " frames\n";
+    std::cout << "  ✓ Recording and replay test passed\n";
+}
+
+// Test: Zero-copy double-buffered snapshots
+void test_track_snapshot() {
+    std::cout << "  Testing track snapshots...\n";
+    
+    ScenarioConfig config;
+    config.target_count = 2000;
+    RadarSimulator radar;
+    radar.setRandomSeed(3);
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+    
+    TrackSnapshot first = radar.getSnapshot();
+    assert(first.tracks.size() == radar.getActiveTrackCount() && "Snapshot holds active tracks");
+    std::vector<Track> first_copy(first.tracks.begin(), first.tracks.end());
+    
+    // The previous picture survives one publish untouched
+    radar.updateTracks(0.1);
+    TrackSnapshot second = radar.getSnapshot();
+    assert(second.generation == first.generation + 1 && "Generation advances per publish");
+    assert(second.tracks.data() != first.tracks.data() && "Publish fills the other buffer");
+    for (size_t i = 0; i < first_copy.size(); ++i) {
+        assert(first.tracks[i].range_m == first_copy[i].range_m && "Old snapshot still valid");
+    }
+    
+    // Snapshot matches the copying accessor
+    auto copy = radar.getCurrentTracks();
+    assert(copy.size() == second.tracks.size());
+    for (size_t i = 0; i < copy.size(); ++i) {
+        assert(copy[i].id == second.tracks[i].id && copy[i].range_m == second.tracks[i].range_m);
+    }
+    
+    // Steady state: the two buffers are reused, never reallocated
+    const Track* buffers[2] = {first.tracks.data(), second.tracks.data()};
+    for (int cycle = 0; cycle < 20; ++cycle) {
+        radar.updateTracks(0.1);
+        const Track* data = radar.getSnapshot().tracks.data();
+        assert((data == buffers[0] || data == buffers[1]) && "Snapshot buffers reused");
+    }
+    
+    std::cout << "    ✓ " << second.tracks.size() << " tracks, generation "
+              << radar.getSnapshot().generation << "\n";
+    std::cout << "  ✓ Track snapshot test passed\n";
+}
+
+// Test: Sensor model detection probability, noise and false alarms
+void test_sensor_model() {
+    std::cout << "  Testing sensor model...\n";
+    
+    ScenarioConfig config;
+    config.target_count = 5000;
+    RadarSimulator radar;
+    radar.setRandomSeed(12);
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+    radar.updateTracks(0.1);
+    std::vector<Track> truth = radar.getCurrentTracks();
+    
+    // Pd = 1, no clutter: one plot per track, noise of the configured size
+    std::vector<Measurement> plots;
+    radar.getMeasurements(plots);
+    assert(plots.size() == truth.size() && "Every track detected at Pd = 1");
+    double range_error_sq = 0.0;
+    for (size_t i = 0; i < plots.size(); ++i) {
+        assert(plots[i].track_id == truth[i].id && "Detections in track order");
+        const double error = plots[i].range_m - truth[i].range_m;
+        range_error_sq += error * error;
+    }
+    const double range_sigma = std::sqrt(range_error_sq / plots.size());
+    assert(std::abs(range_sigma - MeasurementNoise().range_sigma_m) < 2.0 && "Range noise sigma");
+    
+    // Pd = 0.8 with clutter: the detections are a subset of the Pd = 1 plots
+    SensorConfig sensor;
+    sensor.detection_probability = 0.8;
+    sensor.false_alarms_per_scan = 2000.0;
+    radar.setSensorConfig(sensor);
+    std::vector<Measurement> cluttered;
+    radar.getMeasurements(cluttered);
+    SensorStats stats = radar.getSensorStats();
+    assert(stats.detections + stats.missed == truth.size() && "Every track detected or missed");
+    assert(std::abs(static_cast<double>(stats.detections) / truth.size() - 0.8) < 0.03 &&
+           "Detection rate near Pd");
+    assert(std::abs(static_cast<double>(stats.false_alarms) - 2000.0) < 5 * std::sqrt(2000.0) &&
+           "Poisson clutter count near its mean");
+    assert(cluttered.size() == stats.detections + stats.false_alarms);
+    size_t next = 0;
+    for (size_t i = 0; i < stats.detections; ++i) {
+        while (plots[next].track_id != cluttered[i].track_id) {
+            ++next;
+        }
+        assert(plots[next].range_m == cluttered[i].range_m && "Pd does not change the noise");
+    }
+    
+    // False alarms: inside the clutter volume, uniform, and the batch
+    // generator matches the scalar Philox stream
+    const CounterRng::Key key = CounterRng::makeKey(12);
+    double range_sum = 0.0;
+    for (size_t n = 0; n < stats.false_alarms; ++n) {
+        const Measurement& plot = cluttered[stats.detections + n];
+        assert(plot.track_id == FALSE_ALARM_ID && "Clutter carries no track id");
+        assert(plot.range_m >= sensor.clutter_min_range_m && plot.range_m < sensor.clutter_max_range_m);
+        assert(plot.azimuth_rad >= -M_PI && plot.azimuth_rad < M_PI);
+        assert(plot.elevation_rad >= sensor.clutter_min_elevation_rad &&
+               plot.elevation_rad < sensor.clutter_max_elevation_rad);
+        range_sum += plot.range_m;
+        
+        CounterRng::Block block = CounterRng::philox(
+            CounterRng::makeCounter(static_cast<uint32_t>(n), 1, CounterRng::Stream::CLUTTER), key);
+        const double expected = sensor.clutter_min_range_m +
+            (sensor.clutter_max_range_m - sensor.clutter_min_range_m) * (block[0] / 4294967296.0);
+        assert(plot.range_m == expected && "Batch Philox matches the scalar stream");
+    }
+    const double mid_range = 0.5 * (sensor.clutter_min_range_m + sensor.clutter_max_range_m);
+    assert(std::abs(range_sum / stats.false_alarms - mid_range) < 300.0 && "Uniform in range");
+    
+    // Same cycle, same plots
+    std::vector<Measurement> again;
+    radar.getMeasurements(again);
+    assert(again.size() == cluttered.size());
+    for (size_t i = 0; i < again.size(); ++i) {
+        assert(again[i].track_id == cluttered[i].track_id && again[i].range_m == cluttered[i].range_m);
+    }
+    
+    // Small means use the exact Poisson sampler: mean and variance agree
+    double sum = 0.0, sum_sq = 0.0;
+    for (uint64_t cycle = 0; cycle < 20000; ++cycle) {
+        const double count = static_cast<double>(SensorModel::poissonCount(5, cycle, 4.0));
+        sum += count;
+        sum_sq += count * count;
+    }
+    const double mean = sum / 20000.0;
+    assert(std::abs(mean - 4.0) < 0.1 && std::abs(sum_sq / 20000.0 - mean * mean - 4.0) < 0.25 &&
+           "Poisson mean and variance");
+    
+    std::cout << "    ✓ " << stats.detections << " detections, " << stats.missed << " missed, "
+              << stats.false_alarms << " false alarms\n";
+    std::cout << "  ✓ Sensor model test passed\n";
+}
+
+// Test: Tens of thousands of false alarms per scan in steady state
+void test_clutter_throughput() {
+    std::cout << "  Testing clutter throughput...\n";
+    
+    ScenarioConfig config;
+    config.target_count = 1000;
+    RadarSimulator radar;
+    radar.setRandomSeed(13);
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+    SensorConfig sensor;
+    sensor.detection_probability = 0.9;
+    sensor.false_alarms_per_scan = 50000.0;
+    radar.setSensorConfig(sensor);
+    
+    // First scan sizes the buffer; a little headroom covers the Poisson spread
+    std::vector<Measurement> plots;
+    plots.reserve(53000);
+    const Measurement* buffer = plots.data();
+    double worst_ms = 0.0;
+    size_t false_alarms = 0;
+    const int scans = 20;
+    for (int scan = 0; scan < scans; ++scan) {
+        radar.updateTracks(0.1);
+        auto start = std::chrono::high_resolution_clock::now();
+        radar.getMeasurements(plots);
+        auto end = std::chrono::high_resolution_clock::now();
+        worst_ms = std::max(worst_ms, std::chrono::duration<double, std::milli>(end - start).count());
+        false_alarms += radar.getSensorStats().false_alarms;
+        assert(plots.data() == buffer && "Plot buffer reused without reallocation");
+    }
+    assert(false_alarms / scans > 49000 && "Mean clutter load sustained");
+    assert(worst_ms < 100.0 && "Sensor scan fits the cycle budget");
+    
+    std::cout << "    ✓ " << false_alarms / scans << " false alarms per scan, worst scan "
+              << worst_ms << " ms\n";
+    std::cout << "  ✓ Clutter throughput test passed\n";
+}
+
+// Test: Scripted scenarios compiled into trajectory tables
+void test_scripted_scenario() {
+    std::cout << "  Testing scripted scenario...\n";
+    
+    const std::string script =
+        "# Three tracks on one path\n"
+        "track 10 spawn 1.0 count 3 every 2.0 spacing 100 0 0\n"
+        "  waypoint 0 8000 500\n"
+        "  waypoint 0 2000 500 200     # 6000 m at 200 m/s: 30 s\n"
+        "  waypoint 3000 2000 500 300  # 3000 m at 300 m/s: 10 s\n"
+        "end\n";
+    
+    TrajectoryTable table;
+    std::istringstream input(script);
+    if (!table.parse(input)) {
+        throw std::runtime_error("Script parses: " + table.getError());
+    }
+    assert(table.trackCount() == 3 && table.pathCount() == 1 && "Count expands to copies");
+    assert(std::abs(table.pathDuration(0) - 40.0) < 1e-9 && "Leg times from speeds");
+    assert(table.track(2).track_id == 12 && table.track(2).spawn_time_s == 5.0);
+    
+    // Playback is a lookup on the current leg
+    uint32_t leg = TrajectoryTable::NO_LEG;
+    EnuState state = EnuState();
+    if (!table.sample(table.track(1), 15.0, leg, state)) {
+        throw std::runtime_error("Still on its path");
+    }
+    assert(std::abs(state.north_m - 5000.0) < 1e-9 && std::abs(state.east_m - 100.0) < 1e-9);
+    assert(std::abs(state.vel_north_ms + 200.0) < 1e-9 && "Leg velocity");
+    if (!table.sample(table.track(1), 35.0, leg, state)) {
+        throw std::runtime_error("Cursor moves to the next leg");
+    }
+    assert(std::abs(state.east_m - 1600.0) < 1e-9 && std::abs(state.north_m - 2000.0) < 1e-9);
+    if (table.sample(table.track(1), 40.5, leg, state)) {
+        throw std::runtime_error("Path finished");
+    }
+    
+    // Errors name the line
+    const char* bad_scripts[] = {
+        "track 1 spawn 0\n waypoint 0 0 0\n waypoint 1 1 1\n",           // Missing end
+        "track 1 spawn 0\n waypoint 0 0 0\n waypoint 1 1 1 -5\nend\n",  // Bad speed
+        "track 1 spawn 0\n waypoint 0 0 0\nend\n",                       // One waypoint
+        "track 1 spawn 0 count 2 every 1\n waypoint 0 0 0\n waypoint 1 1 1 50\nend\n"
+        "track 2 spawn 0\n waypoint 0 0 0\n waypoint 1 1 1 50\nend\n",  // Duplicate id
+        "fly 1 2 3\n",                                                     // Unknown directive
+    };
+    for (const char* bad : bad_scripts) {
+        std::istringstream bad_input(bad);
+        if (table.parse(bad_input)) {
+            throw std::runtime_error("Invalid script rejected");
+        }
+        assert(table.getError().compare(0, 5, "line ") == 0 && table.empty());
+    }
+    if (table.load("/tmp/does_not_exist.scn")) {
+        throw std::runtime_error("Missing file rejected");
+    }
+    
+    // Scenario playback through the columnar store
+    const std::string path = "/tmp/test_radar_scripted.scn";
+    {
+        std::ofstream file(path);
+        file << script;
+    }
+    ScenarioManager manager;
+    if (!manager.loadScript(path)) {
+        throw std::runtime_error("Script file loads");
+    }
+    manager.setScenario(ScenarioType::SCRIPTED);
+    assert(manager.getConfig().target_count == 3 && "Target count from the script");
+    
+    TrackStore store;
+    manager.generateInitialTracks(store);
+    assert(store.empty() && "Nothing spawns before t = 1 s");
+    for (int cycle = 0; cycle < 160; ++cycle) {
+        manager.updateTracks(store, 0.1);
+    }
+    
+    // t = 16 s: track 10 is 15 s into its path
+    assert(store.size() == 3 && "All three spawned on schedule");
+    size_t index = 0;
+    if (!store.find(10, index)) {
+        throw std::runtime_error("Scripted id kept");
+    }
+    Track track10 = store.track(index);
+    assert(std::abs(track10.range_m - std::hypot(5000.0, 500.0)) < 1e-6 && "Position from the table");
+    assert(std::abs(track10.azimuth_rad) < 1e-9 && "Due north");
+    assert(store.age_cycles[index] == 150 && "Aged since spawn");
+    
+    // Tracks leave at the end of their script (t = 45 s for the last one)
+    for (int cycle = 0; cycle < 300; ++cycle) {
+        manager.updateTracks(store, 0.1);
+    }
+    assert(store.empty() && "Finished tracks removed");
+    assert(manager.getCycleStats().tracks_spawned == 3);
+    
+    // The vector path replays the same positions
+    ScenarioManager row_manager;
+    row_manager.loadScript(path);
+    row_manager.setScenario(ScenarioType::SCRIPTED);
+    std::vector<TrackState> rows = row_manager.generateInitialTracks();
+    for (int cycle = 0; cycle < 160; ++cycle) {
+        row_manager.updateTracks(rows, 0.1);
+    }
+    assert(rows.size() == 3 && "Vector path spawns the same tracks");
+    for (const auto& row : rows) {
+        if (row.track.id == 10 && std::abs(row.track.range_m - track10.range_m) >= 1e-6) {
+            throw std::runtime_error("Vector and columnar paths agree");
+        }
+    }
+    
+    // Thousands of scripted tracks: each cycle is a table lookup per track
+    {
+        std::ofstream file(path);
+        file << "track 1 spawn 0 count 5000 every 0 spacing 1 0 0\n"
+                "  waypoint -6000 9000 2000\n"
+                "  waypoint 0 3000 1000 250\n"
+                "  waypoint 6000 9000 2000 250\n"
+                "end\n";
+    }
+    RadarSimulator radar;
+    if (!radar.loadScript(path) || !radar.getScriptError().empty()) {
+        throw std::runtime_error("Radar loads the script: " + radar.getScriptError());
+    }
+    radar.setScenario(ScenarioType::SCRIPTED);
+    assert(radar.getActiveTrackCount() == 5000 && "All spawned at t = 0");
+    for (int cycle = 0; cycle < 50; ++cycle) {
+        radar.updateTracks(0.1);
+    }
+    
+    std::cout << "    ✓ 5000 scripted tracks, " << radar.getCycleStats().meanUpdateMs()
+              << "ms per cycle\n";
+    std::cout << "  ✓ Scripted scenario test passed\n";
+}
+
 int main() {
     std::cout << "\nTesting Enhanced Radar Simulation...\n\n";
     
@@ -438,16 +1446,31 @@ int main() {
         test_single_target_scenario();
         test_swarm_scenario();
         test_saturation_scenario();
+        test_mass_raid_scenario();
         test_track_creation();
         test_track_bounds();
         test_track_removal();
         test_track_history();
+        test_track_history_ring_buffer();
         test_velocity_constraints();
         test_mixed_motion_models();
         test_track_age();
         test_scenario_configuration();
         test_track_update_frequency();
         test_active_track_counting();
+        test_track_store();
+        test_track_store_handles();
+        test_batch_motion_kernels();
+        test_cartesian_propagation();
+        test_parallel_update();
+        test_motion_model_buckets();
+        test_counter_rng();
+        test_virtual_clock();
+        test_recording_replay();
+        test_track_snapshot();
+        test_scripted_scenario();
+        test_sensor_model();
+        test_clutter_throughput();
         
         std::cout << "\n✓ All enhanced radar simulation tests passed!\n";
         return 0;
@@ -1,6 +1,13 @@
+#include "c2_controller/closest_approach.hpp"
 #include "c2_controller/threat_evaluator.hpp"
+#include "c2_controller/threat_policy.hpp"
+#include "common/kernel_isa.hpp"
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <random>
 
 int main() {
     std::cout << "Running threat evaluator tests..." << std::endl;
@@ -36,6 +43,203 @@ int main() {
     assert(prioritized[0].score >= prioritized[1].score);  // Should be sorted
     std::cout << "  ✓ Threat prioritization test passed" << std::endl;
     
+    // Test 4: Batch scoring matches evaluate() bit for bit on every ISA
+    namespace common = skyguardis::common;
+    const size_t BATCH = 100003;  // Odd count exercises the scalar remainder
+    std::mt19937 rng(22);
+    std::uniform_real_distribution<double> range(0.0, 50000.0);
+    std::uniform_real_distribution<double> speed(0.0, 1200.0);
+    std::uniform_real_distribution<double> angle(-3.14, 3.14);
+    std::vector<skyguardis::c2::Track> picture(BATCH);
+    std::uniform_real_distribution<double> elevation(0.0, 0.5);
+    std::vector<double> range_m(BATCH), azimuth_rad(BATCH), elevation_rad(BATCH);
+    std::vector<double> velocity_ms(BATCH), heading_rad(BATCH);
+    for (size_t i = 0; i < BATCH; ++i) {
+        picture[i].id = static_cast<uint32_t>(i + 1);
+        picture[i].range_m = range_m[i] = range(rng);
+        picture[i].azimuth_rad = azimuth_rad[i] = angle(rng);
+        picture[i].elevation_rad = elevation_rad[i] = elevation(rng);
+        picture[i].velocity_ms = velocity_ms[i] = speed(rng);
+        picture[i].heading_rad = heading_rad[i] = angle(rng);
+    }
+    skyguardis::c2::TrackColumns columns;
+    columns.range_m = range_m.data();
+    columns.azimuth_rad = azimuth_rad.data();
+    columns.elevation_rad = elevation_rad.data();
+    columns.velocity_ms = velocity_ms.data();
+    columns.heading_rad = heading_rad.data();
+    columns.count = BATCH;
+    
+    std::vector<double> reference(BATCH);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < BATCH; ++i) {
+        reference[i] = evaluator.evaluate(picture[i]).score;
+    }
+    const double per_track_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    
+    const common::KernelIsa best = common::detectKernelIsa();
+    const common::KernelIsa isas[] = {common::KernelIsa::SCALAR, common::KernelIsa::SSE41,
+                                      common::KernelIsa::AVX2};
+    std::vector<double> batch(BATCH);
+    for (common::KernelIsa isa : isas) {
+        common::setKernelIsa(isa);
+        std::fill(batch.begin(), batch.end(), -1.0);
+        start = std::chrono::steady_clock::now();
+        evaluator.scoreBatch(columns, batch.data());
+        const double batch_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        assert(std::memcmp(batch.data(), reference.data(), BATCH * sizeof(double)) == 0 &&
+               "Batch scores identical to evaluate()");
+        std::cout << "    ✓ " << BATCH << " tracks, " << common::kernelIsaName(common::getKernelIsa())
+                  << " batch " << batch_us << "us vs per-track " << per_track_us << "us" << std::endl;
+    }
+    common::setKernelIsa(best);
+    
+    // The per-track ranking carries the same scores
+    auto ranked = evaluator.prioritize(picture);
+    assert(ranked.size() == BATCH);
+    for (const auto& ranked_score : ranked) {
+        auto single = evaluator.evaluate(picture[ranked_score.track_id - 1]);
+        assert(ranked_score.score == single.score && ranked_score.priority == single.priority);
+    }
+    std::cout << "  ✓ Batch threat scoring test passed" << std::endl;
+    
+    // Test 5: Closest-approach geometry
+    skyguardis::c2::Track inbound;
+    inbound.id = 10;
+    inbound.range_m = 5000.0;
+    inbound.azimuth_rad = 0.0;           // Due north...
+    inbound.elevation_rad = 0.0;
+    inbound.velocity_ms = 100.0;
+    inbound.heading_rad = 3.14159265358979323846;  // ...flying south at the radar
+    auto approach = skyguardis::c2::closestApproach(inbound);
+    assert(std::fabs(approach.miss_distance_m) < 1e-3 && "Head-on track passes overhead");
+    assert(std::fabs(approach.time_to_go_s - 50.0) < 1e-9);
+    assert(std::fabs(approach.closing_speed_ms - 100.0) < 1e-9);
+    
+    skyguardis::c2::Track crossing = inbound;
+    crossing.id = 11;
+    crossing.azimuth_rad = 3.14159265358979323846 / 2.0;  // East, flying north
+    crossing.heading_rad = 0.0;
+    approach = skyguardis::c2::closestApproach(crossing);
+    assert(std::fabs(approach.miss_distance_m - 5000.0) < 1e-6 && approach.time_to_go_s < 1e-9 &&
+           std::fabs(approach.closing_speed_ms) < 1e-9 && "Crossing track is at its closest point");
+    
+    skyguardis::c2::Track diving = inbound;
+    diving.elevation_rad = 0.6435011087932844;  // 3-4-5 triangle: 4 km out, 3 km up
+    approach = skyguardis::c2::closestApproach(diving);
+    assert(std::fabs(approach.miss_distance_m - 3000.0) < 1e-6 && "Passes overhead at altitude");
+    assert(std::fabs(approach.time_to_go_s - 40.0) < 1e-9);
+    std::cout << "  ✓ Closest-approach geometry test passed" << std::endl;
+    
+    // Test 6: The closest-approach model ranks a slow inbound track above
+    // a fast one flying away, which the range/speed model gets backwards
+    skyguardis::c2::Track receding = inbound;
+    receding.id = 12;
+    receding.range_m = 4000.0;
+    receding.velocity_ms = 300.0;
+    receding.heading_rad = 0.0;               // North, away from the radar
+    std::vector<skyguardis::c2::Track> encounter = {inbound, crossing, receding};
+    
+    auto by_range = evaluator.prioritize(encounter);
+    assert(by_range[0].track_id == receding.id && "Range/speed model prefers the fast receding track");
+    
+    const skyguardis::c2::ThreatPolicy* cpa_policy = skyguardis::c2::findThreatPolicy("cpa");
+    assert(cpa_policy && "Closest-approach policy registered");
+    skyguardis::c2::ThreatEvaluator cpa(*cpa_policy);
+    assert(&cpa.getPolicy() == cpa_policy);
+    auto by_approach = cpa.prioritize(encounter);
+    assert(by_approach[0].track_id == inbound.id && by_approach[2].track_id == receding.id &&
+           "Inbound first, receding last");
+    assert(cpa.evaluate(receding).score < 1e-9 && "Track flying straight away scores nothing");
+    
+    std::cout << "  ✓ Closest-approach prioritization test passed" << std::endl;
+    
+    // Test 7: Bulk closest-approach scoring agrees with the per-track path
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < BATCH; ++i) {
+        reference[i] = cpa.evaluate(picture[i]).score;
+    }
+    const double cpa_per_track_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    for (common::KernelIsa isa : isas) {
+        common::setKernelIsa(isa);
+        start = std::chrono::steady_clock::now();
+        cpa.scoreBatch(columns, batch.data());
+        const double batch_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        for (size_t i = 0; i < BATCH; ++i) {
+            assert(std::fabs(batch[i] - reference[i]) <= 1e-12 + 1e-9 * std::fabs(reference[i]) &&
+                   "Batch closest approach within rounding of evaluate()");
+        }
+        std::cout << "    ✓ " << BATCH << " tracks, " << common::kernelIsaName(common::getKernelIsa())
+                  << " closest approach batch " << batch_us << "us vs per-track " << cpa_per_track_us
+                  << "us" << std::endl;
+    }
+    common::setKernelIsa(best);
+    
+    std::vector<skyguardis::c2::ThreatEvaluator::ThreatScore> top;
+    cpa.topK(picture, 10, top);
+    ranked = cpa.prioritize(picture);
+    for (size_t i = 0; i < top.size(); ++i) {
+        assert(top[i].track_id == ranked[i].track_id && "Top-K matches the closest-approach ranking");
+        assert(std::fabs(top[i].score - cpa.evaluate(picture[top[i].track_id - 1]).score) < 1e-9);
+    }
+    std::cout << "  ✓ Bulk closest-approach scoring test passed" << std::endl;
+    
+    // Test 8: Policy registry and compile-time policies
+    using skyguardis::c2::PolicyEvaluator;
+    assert(skyguardis::c2::threatPolicyCount() >= 2);
+    assert(&evaluator.getPolicy() == skyguardis::c2::threatPolicy(0) &&
+           std::strcmp(evaluator.getPolicy().name, "range") == 0 && "Range/speed is the default");
+    assert(skyguardis::c2::findThreatPolicy("range") == skyguardis::c2::threatPolicy(0));
+    assert(!skyguardis::c2::findThreatPolicy("nearest") && "Unknown policy");
+    for (size_t p = 0; p < skyguardis::c2::threatPolicyCount(); ++p) {
+        const skyguardis::c2::ThreatPolicy* policy = skyguardis::c2::threatPolicy(p);
+        assert(policy && skyguardis::c2::findThreatPolicy(policy->name) == policy && policy->description);
+    }
+    assert(!skyguardis::c2::threatPolicy(skyguardis::c2::threatPolicyCount()) && "Index past the registry");
+    
+    // The registry and a direct instantiation run the same code
+    auto direct = PolicyEvaluator<skyguardis::c2::ClosestApproachPolicy>::evaluate(picture[7]);
+    auto registered = cpa.evaluate(picture[7]);
+    assert(direct.track_id == registered.track_id && direct.score == registered.score &&
+           direct.priority == registered.priority);
+    
+    PolicyEvaluator<skyguardis::c2::RangeSpeedPolicy>::topK(picture, 10, top);
+    std::vector<skyguardis::c2::ThreatEvaluator::ThreatScore> via_registry;
+    start = std::chrono::steady_clock::now();
+    evaluator.topK(picture, 10, via_registry);
+    const double registry_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    PolicyEvaluator<skyguardis::c2::RangeSpeedPolicy>::topK(picture, 10, top);
+    const double direct_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < top.size(); ++i) {
+        assert(top[i].track_id == via_registry[i].track_id && top[i].score == via_registry[i].score);
+    }
+    std::cout << "    ✓ top-10 of " << BATCH << " tracks: registry " << registry_us << "us, direct "
+              << direct_us << "us" << std::endl;
+    std::cout << "  ✓ Threat policy registry test passed" << std::endl;
+    
+    // Test 9: Ranked scores lead straight back to their tracks
+    assert(evaluator.evaluate(picture[3]).track_index ==
+           skyguardis::c2::ThreatEvaluator::NO_TRACK_INDEX && "A single score has no span");
+    for (const skyguardis::c2::ThreatEvaluator* policy_evaluator : {&evaluator, &cpa}) {
+        ranked = policy_evaluator->prioritize(picture);
+        policy_evaluator->topK(picture, 10, top);
+        for (const auto& ranked_score : ranked) {
+            assert(ranked_score.track_index < picture.size() &&
+                   picture[ranked_score.track_index].id == ranked_score.track_id);
+        }
+        for (const auto& top_score : top) {
+            assert(picture[top_score.track_index].id == top_score.track_id);
+        }
+    }
+    std::cout << "  ✓ Track index test passed" << std::endl;
+    
     std::cout << "All tests passed!" << std::endl;
     return 0;
 }
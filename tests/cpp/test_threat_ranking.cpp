@@ -0,0 +1,226 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "c2_controller/threat_evaluator.hpp"
+#include "c2_controller/threat_ranking.hpp"
+
+using namespace skyguardis::c2;
+
+namespace {
+
+Track randomTrack(uint32_t id, std::mt19937& rng) {
+    std::uniform_real_distribution<double> range(500.0, 20000.0);
+    std::uniform_real_distribution<double> angle(-3.14, 3.14);
+    std::uniform_real_distribution<double> speed(50.0, 300.0);
+    Track track;
+    track.id = id;
+    track.range_m = range(rng);
+    track.azimuth_rad = angle(rng);
+    track.elevation_rad = 0.1;
+    track.velocity_ms = speed(rng);
+    track.heading_rad = angle(rng);
+    return track;
+}
+
+bool sameOrder(const std::vector<ThreatEvaluator::ThreatScore>& a,
+               const std::vector<ThreatEvaluator::ThreatScore>& b, size_t count) {
+    if (a.size() < count || b.size() < count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (a[i].track_id != b[i].track_id || a[i].score != b[i].score) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+// Test: topK is the head of the full ranking, ties included
+void test_top_k_selection() {
+    std::cout << "  Testing top-K selection...\n";
+
+    std::mt19937 rng(21);
+    std::vector<Track> tracks;
+    for (uint32_t id = 1; id <= 1000; ++id) {
+        tracks.push_back(randomTrack(id, rng));
+    }
+    // Duplicated kinematics: equal scores resolve by track id
+    for (uint32_t id = 1001; id <= 1010; ++id) {
+        Track copy = tracks[0];
+        copy.id = id;
+        tracks.push_back(copy);
+    }
+
+    ThreatEvaluator evaluator;
+    const auto full = evaluator.prioritize(tracks);
+    for (size_t i = 1; i < full.size(); ++i) {
+        assert(!ThreatEvaluator::ranksHigher(full[i], full[i - 1]) && "Full ranking sorted");
+    }
+
+    std::vector<ThreatEvaluator::ThreatScore> top;
+    for (size_t k : {size_t(1), size_t(7), size_t(100), tracks.size()}) {
+        evaluator.topK(tracks, k, top);
+        assert(top.size() == k && "k results");
+        assert(sameOrder(top, full, k) && "Top-K matches the head of prioritize()");
+    }
+    evaluator.topK(tracks, tracks.size() + 5, top);
+    assert(top.size() == tracks.size() && "k beyond the picture returns every track");
+    evaluator.topK(tracks, 0, top);
+    assert(top.empty() && "k = 0 returns nothing");
+    evaluator.topK(TrackSpan(), 3, top);
+    assert(top.empty() && "Empty picture");
+
+    std::cout << "  ✓ Top-K selection test passed\n";
+}
+
+// Test: The incremental ranking follows inserts, changes and removals
+void test_incremental_ranking() {
+    std::cout << "  Testing incremental ranking...\n";
+
+    std::mt19937 rng(22);
+    std::vector<Track> tracks;
+    uint32_t next_id = 1;
+    for (; next_id <= 500; ++next_id) {
+        tracks.push_back(randomTrack(next_id, rng));
+    }
+
+    ThreatEvaluator evaluator;
+    ThreatRanking ranking(evaluator);
+    ranking.sync(tracks);
+    assert(ranking.size() == 500 && ranking.getStats().inserted == 500 && "Initial picture inserted");
+
+    std::vector<ThreatEvaluator::ThreatScore> expected;
+    std::vector<ThreatEvaluator::ThreatScore> ranked;
+    for (int cycle = 0; cycle < 50; ++cycle) {
+        // Churn: a few tracks move, one leaves, one arrives
+        size_t moved = 0;
+        for (Track& track : tracks) {
+            if (rng() % 20 == 0) {
+                track.range_m *= 0.95;
+                ++moved;
+            }
+        }
+        tracks.erase(tracks.begin() + rng() % tracks.size());
+        tracks.push_back(randomTrack(next_id++, rng));
+
+        ranking.sync(tracks);
+        const RankingStats& stats = ranking.getStats();
+        assert(stats.inserted == 1 && stats.removed == 1 && "One arrival, one departure");
+        assert(stats.rescored <= moved && stats.rescored + stats.unchanged + stats.inserted == tracks.size() &&
+               "Only changed tracks rescored");
+
+        evaluator.topK(tracks, 20, expected);
+        ranking.topK(20, ranked);
+        assert(sameOrder(ranked, expected, 20) && "Incremental top-20 matches a fresh ranking");
+        for (const auto& score : ranked) {
+            assert(tracks[score.track_index].id == score.track_id && "Index into the synced picture");
+        }
+    }
+
+    // Direct updates and removals
+    ThreatEvaluator::ThreatScore best = ThreatEvaluator::ThreatScore();
+    if (!ranking.top(best) || best.track_id != expected[0].track_id) {
+        throw std::runtime_error("Top matches the full sort");
+    }
+    Track closest = tracks[0];
+    closest.range_m = 1.0;
+    closest.velocity_ms = 1000.0;
+    ranking.update(closest);
+    if (!ranking.top(best) || best.track_id != closest.id) {
+        throw std::runtime_error("Rescored track rises to the top");
+    }
+    if (!ranking.remove(closest.id) || ranking.contains(closest.id)) {
+        throw std::runtime_error("Removed track leaves the ranking");
+    }
+    if (ranking.remove(closest.id)) {
+        throw std::runtime_error("Second removal reports a missing track");
+    }
+    if (!ranking.top(best) || best.track_id == closest.id) {
+        throw std::runtime_error("Next track takes the top");
+    }
+
+    ranking.topK(ranking.size(), ranked);
+    for (size_t i = 1; i < ranked.size(); ++i) {
+        assert(!ThreatEvaluator::ranksHigher(ranked[i], ranked[i - 1]) && "Full walk in order");
+    }
+    ranking.clear();
+    if (!ranking.empty() || ranking.top(best)) {
+        throw std::runtime_error("Clear empties the ranking");
+    }
+
+    std::cout << "  ✓ Incremental ranking test passed\n";
+}
+
+// Test: Ranking cost follows churn, not picture size
+void test_ranking_scaling() {
+    std::cout << "  Testing ranking cost at scale...\n";
+
+    const size_t TRACK_COUNT = 50000;
+    const size_t CHANGED = TRACK_COUNT / 100;
+    std::mt19937 rng(23);
+    std::vector<Track> tracks;
+    for (uint32_t id = 1; id <= TRACK_COUNT; ++id) {
+        tracks.push_back(randomTrack(id, rng));
+    }
+
+    ThreatEvaluator evaluator;
+    ThreatRanking ranking(evaluator);
+    ranking.sync(tracks);
+
+    // 1% of the picture changes this cycle
+    std::vector<size_t> changed;
+    for (size_t i = 0; i < CHANGED; ++i) {
+        size_t index = rng() % TRACK_COUNT;
+        tracks[index].range_m *= 0.9;
+        changed.push_back(index);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto full = evaluator.prioritize(tracks);
+    const double sort_us = elapsedUs(start);
+
+    std::vector<ThreatEvaluator::ThreatScore> top;
+    start = std::chrono::steady_clock::now();
+    evaluator.topK(tracks, 10, top);
+    const double select_us = elapsedUs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t index : changed) {
+        ranking.update(tracks[index]);
+    }
+    std::vector<ThreatEvaluator::ThreatScore> incremental;
+    ranking.topK(10, incremental);
+    const double update_us = elapsedUs(start);
+
+    assert(sameOrder(top, full, 10) && sameOrder(incremental, full, 10) && "All paths agree");
+
+    std::cout << "    ✓ " << TRACK_COUNT << " tracks: full sort " << sort_us << "us, top-10 select "
+              << select_us << "us, incremental (" << CHANGED << " changed) " << update_us << "us\n";
+    std::cout << "  ✓ Ranking scaling test passed\n";
+}
+
+int main() {
+    std::cout << "\nTesting Threat Ranking...\n\n";
+
+    try {
+        test_top_k_selection();
+        test_incremental_ranking();
+        test_ranking_scaling();
+
+        std::cout << "\n✓ All threat ranking tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n✗ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
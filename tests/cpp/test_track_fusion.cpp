@@ -0,0 +1,302 @@
+#include "c2_controller/track_fusion.hpp"
+#include "radar_simulator/motion_kernels.hpp"
+#include "radar_simulator/radar_simulator.hpp"
+#include "radar_simulator/sensor_network.hpp"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+using namespace skyguardis::c2;
+using namespace skyguardis::radar;
+namespace common = skyguardis::common;
+
+namespace {
+
+SensorSpec makeSpec(double east_m, double north_m, double up_m, double scan_period_s,
+                    double latency_s) {
+    SensorSpec spec;
+    spec.sensor.site_east_m = east_m;
+    spec.sensor.site_north_m = north_m;
+    spec.sensor.site_up_m = up_m;
+    spec.scan_period_s = scan_period_s;
+    spec.latency_s = latency_s;
+    return spec;
+}
+
+// Registers every network sensor with the fusion stage at the same site
+void addSensors(const SensorNetwork& network, TrackFusion& fusion) {
+    for (uint32_t s = 0; s < network.size(); ++s) {
+        const SensorConfig& sensor = network.getSpec(s).sensor;
+        SensorSite site = {sensor.site_east_m, sensor.site_north_m, sensor.site_up_m};
+        if (fusion.addSensor(site) != s) {
+            throw std::runtime_error("Sensors registered in network order");
+        }
+    }
+}
+
+// One C2 cycle: deliver the reports due by now, then fuse at now
+void runCycle(RadarSimulator& radar, SensorNetwork& network, TrackFusion& fusion,
+              std::vector<SensorReport>& reports, double now) {
+    radar.updateTracks(0.1);
+    network.scan(radar, now);
+    network.collect(now, reports);
+    for (const auto& report : reports) {
+        fusion.processReport(report.sensor, report.plots, report.time_s);
+    }
+    fusion.fuse(now);
+}
+
+double distance(const EnuState& a, const EnuState& b) {
+    const double de = a.east_m - b.east_m;
+    const double dn = a.north_m - b.north_m;
+    const double du = a.up_m - b.up_m;
+    return std::sqrt(de * de + dn * dn + du * du);
+}
+
+} // namespace
+
+// Test: Sensor network schedules scans and delays reports by their latency
+void test_sensor_network_schedule() {
+    std::cout << "  Testing sensor network schedule...\n";
+
+    ScenarioConfig config;
+    config.target_count = 5;
+    RadarSimulator radar;
+    radar.setRandomSeed(2);
+    radar.setScenario(ScenarioType::SATURATION, config);
+
+    SensorNetwork network;
+    network.addSensor(makeSpec(0.0, 0.0, 0.0, 0.1, 0.0));
+    network.addSensor(makeSpec(5000.0, 0.0, 0.0, 0.25, 0.3));
+
+    std::vector<SensorReport> reports;
+    size_t counts[2] = {0, 0};
+    for (int cycle = 1; cycle <= 20; ++cycle) {
+        const double now = cycle * 0.1;
+        radar.updateTracks(0.1);
+        network.scan(radar, now);
+        network.collect(now, reports);
+        for (size_t i = 0; i < reports.size(); ++i) {
+            const SensorReport& report = reports[i];
+            const double latency = network.getSpec(report.sensor).latency_s;
+            assert(report.time_s + latency <= now + 1e-9 && "Delivered after its latency");
+            assert(report.time_s + latency > now - 0.1 - 1e-9 && "Delivered on the first chance");
+            assert((i == 0 || reports[i - 1].time_s <= report.time_s) && "Measurement order");
+            counts[report.sensor]++;
+        }
+    }
+    assert(counts[0] == 20 && "Sensor 0 scans every cycle");
+    // Sensor 1 scans at 0.1, 0.4 (first cycle at or after 0.35), 0.6, ...;
+    // scans after 1.7 s are still in flight
+    assert(counts[1] >= 6 && counts[1] <= 8 && "Sensor 1 scans on its own period");
+    assert(network.pendingCount() > 0 && "Latent reports held back");
+
+    // Different sites see the same target at different ranges, with independent noise
+    std::vector<Measurement> near_plots, far_plots;
+    SensorModel near_sensor(network.getSpec(0).sensor), far_sensor(network.getSpec(1).sensor);
+    radar.getMeasurements(near_sensor, near_plots);
+    radar.getMeasurements(far_sensor, far_plots);
+    assert(near_plots.size() == far_plots.size() && near_plots[0].track_id == far_plots[0].track_id);
+    assert(std::fabs(near_plots[0].range_m - far_plots[0].range_m) > 100.0 && "Site offset applied");
+
+    std::cout << "  ✓ Sensor network schedule test passed\n";
+}
+
+// Test: Three sensors with different rates and latencies fuse into one
+// time-aligned picture
+void test_time_aligned_fusion() {
+    std::cout << "  Testing time-aligned fusion...\n";
+
+    ScenarioConfig config;
+    config.target_count = 1000;
+    RadarSimulator radar;
+    radar.setRandomSeed(21);
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+
+    SensorNetwork network;
+    network.addSensor(makeSpec(0.0, 0.0, 0.0, 0.1, 0.0));
+    network.addSensor(makeSpec(12000.0, 0.0, 20.0, 0.2, 0.15));
+    network.addSensor(makeSpec(0.0, -15000.0, 50.0, 0.5, 0.3));
+    TrackFusion fusion;
+    addSensors(network, fusion);
+
+    std::vector<SensorReport> reports;
+    double now = 0.0;
+    for (int cycle = 1; cycle <= 60; ++cycle) {
+        now = cycle * 0.1;
+        runCycle(radar, network, fusion, reports, now);
+    }
+
+    // Truth and each picture at the fusion time, by id
+    std::vector<Track> truth = radar.getCurrentTracks();
+    std::unordered_map<uint32_t, EnuState> fused;
+    for (const Track& track : fusion.getTracks()) {
+        fused[track.id] = common::toEnu(track);
+    }
+    assert(fused.size() == fusion.getTracks().size() && "Fused ids are unique");
+
+    // Sensor 2's picture left at its last scan lags its targets; the same
+    // picture extrapolated to the fusion time does not
+    const TrackerBank& latent = fusion.getSensorBank(2);
+    assert(now - latent.getTime() >= 0.3 - 1e-9 && "Latent sensor is behind");
+    TrackEstimates aligned;
+    latent.extrapolate(now, aligned);
+    std::unordered_map<uint32_t, size_t> aligned_row;
+    for (size_t i = 0; i < aligned.size(); ++i) {
+        aligned_row[aligned.id[i]] = i;
+    }
+
+    // Accuracy on the straight-flying targets: maneuvering ones add a
+    // constant-velocity filter lag that hides the fusion and latency effects
+    double fused_sum = 0.0, single_sum = 0.0, stale_sum = 0.0, aligned_sum = 0.0;
+    size_t matched = 0, compared = 0;
+    const TrackStore& store = radar.getTrackStore();
+    for (const Track& target : truth) {
+        size_t truth_row = 0;
+        if (!store.find(target.id, truth_row)) {
+            throw std::runtime_error("Target still simulated");
+        }
+        if (store.motion_model[truth_row] != MotionModel::LINEAR) {
+            continue;
+        }
+        const EnuState truth_enu = common::toEnu(target);
+        auto found = fused.find(target.id);
+        assert(found != fused.end() && "Every target in the fused picture");
+        const double error = distance(found->second, truth_enu);
+        assert(error < 150.0 && "Fused track close to its target");
+        fused_sum += error * error;
+        ++matched;
+
+        // Sensor 0 alone (nearest the targets, every cycle, no latency)
+        Track local = Track();
+        if (!fusion.getSensorBank(0).findTrack(target.id, local)) {
+            throw std::runtime_error("Nearest sensor tracks every target");
+        }
+        const double local_error = distance(common::toEnu(local), truth_enu);
+        single_sum += local_error * local_error;
+
+        Track stale;
+        auto row = aligned_row.find(target.id);
+        if (latent.findTrack(target.id, stale) && row != aligned_row.end()) {
+            EnuState stale_enu = common::toEnu(stale);
+            stale_enu.north_m -= 15000.0;
+            stale_enu.up_m += 50.0;
+            EnuState aligned_enu = {aligned.position.east_m[row->second],
+                                    aligned.position.north_m[row->second] - 15000.0,
+                                    aligned.position.up_m[row->second] + 50.0, 0.0, 0.0, 0.0};
+            const double stale_error = distance(stale_enu, truth_enu);
+            const double aligned_error = distance(aligned_enu, truth_enu);
+            stale_sum += stale_error * stale_error;
+            aligned_sum += aligned_error * aligned_error;
+            ++compared;
+        }
+    }
+    const double fused_rms = std::sqrt(fused_sum / matched);
+    const double single_rms = std::sqrt(single_sum / matched);
+    const double stale_rms = std::sqrt(stale_sum / compared);
+    const double aligned_rms = std::sqrt(aligned_sum / compared);
+    assert(compared > matched / 2 && "Latent sensor tracks most targets");
+    assert(aligned_rms < 0.7 * stale_rms && "Extrapolation removes the latency lag");
+    assert(fused_rms < single_rms && "Fusion beats the best single sensor");
+
+    // Duplicates are merged: a target seen by several sensors appears once
+    // (the sensors share the simulator's ids, so their union is the ideal
+    // picture; it includes coasting tracks of targets that just left)
+    std::unordered_map<uint32_t, int> local_ids;
+    for (uint32_t s = 0; s < fusion.sensorCount(); ++s) {
+        for (const Track& track : fusion.getSensorBank(s).getTracks()) {
+            local_ids[track.id]++;
+        }
+    }
+    const FusionStats& stats = fusion.getStats();
+    assert(stats.merged > truth.size() && "Sensors' tracks merged");
+    assert(stats.fused_tracks == stats.local_tracks - stats.merged);
+    assert(stats.fused_tracks >= local_ids.size() && "No target lost in the merge");
+    assert(stats.fused_tracks <= local_ids.size() + local_ids.size() / 20 && "Few unmerged duplicates");
+
+    std::cout << "    ✓ " << truth.size() << " targets, " << stats.local_tracks
+              << " local tracks fused into " << stats.fused_tracks << "\n";
+    std::cout << "    ✓ Fused RMS " << fused_rms << " m (sensor 0 alone " << single_rms
+              << " m); latent sensor stale " << stale_rms << " m, aligned " << aligned_rms << " m\n";
+    std::cout << "  ✓ Time-aligned fusion test passed\n";
+}
+
+// Benchmark: C2 cycle time (local tracking of every report plus fusion)
+// against the number of sensors
+void benchmark_fusion_scaling() {
+    std::cout << "  Benchmarking C2 cycle time vs sensor count...\n";
+    std::cout << "    sensors   local tracks   fused   cycle (ms)   per sensor (ms)\n";
+
+    const size_t sensor_counts[] = {1, 2, 4, 8};
+    for (size_t count : sensor_counts) {
+        ScenarioConfig config;
+        config.target_count = 2000;
+        RadarSimulator radar;
+        radar.setRandomSeed(30);
+        radar.setScenario(ScenarioType::MASS_RAID, config);
+
+        // Sites on a 10 km ring, every sensor at the C2 rate
+        SensorNetwork network;
+        for (size_t s = 0; s < count; ++s) {
+            const double angle = 2.0 * M_PI * s / count;
+            const double radius = s == 0 ? 0.0 : 10000.0;
+            network.addSensor(makeSpec(radius * std::sin(angle), radius * std::cos(angle),
+                                       0.0, 0.1, 0.0));
+        }
+        TrackFusion fusion;
+        addSensors(network, fusion);
+
+        std::vector<SensorReport> reports;
+        double total_ms = 0.0;
+        const int warmup = 5, cycles = 15;
+        for (int cycle = 1; cycle <= warmup + cycles; ++cycle) {
+            const double now = cycle * 0.1;
+            radar.updateTracks(0.1);
+            network.scan(radar, now);
+            network.collect(now, reports);
+
+            // Time only the C2 side
+            auto start = std::chrono::steady_clock::now();
+            for (const auto& report : reports) {
+                fusion.processReport(report.sensor, report.plots, report.time_s);
+            }
+            fusion.fuse(now);
+            auto end = std::chrono::steady_clock::now();
+            if (cycle > warmup) {
+                total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+            }
+        }
+        const double cycle_ms = total_ms / cycles;
+        const FusionStats& stats = fusion.getStats();
+        assert(stats.sensors == count && stats.fused_tracks < stats.local_tracks + 1);
+
+        std::cout << "    " << std::setw(7) << count << "   " << std::setw(12) << stats.local_tracks
+                  << "   " << std::setw(5) << stats.fused_tracks << "   " << std::setw(10)
+                  << std::fixed << std::setprecision(2) << cycle_ms << "   " << std::setw(15)
+                  << cycle_ms / count << "\n";
+        std::cout.unsetf(std::ios::fixed);
+    }
+
+    std::cout << "  ✓ Fusion benchmark complete\n";
+}
+
+int main() {
+    std::cout << "Running track fusion tests...\n";
+
+    try {
+        test_sensor_network_schedule();
+        test_time_aligned_fusion();
+        benchmark_fusion_scaling();
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All track fusion tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,302 @@
+#include "c2_controller/tracker_bank.hpp"
+#include "radar_simulator/counter_rng.hpp"
+#include "radar_simulator/motion_kernels.hpp"
+#include "radar_simulator/radar_simulator.hpp"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace skyguardis::c2;
+using namespace skyguardis::radar;
+namespace common = skyguardis::common;
+
+namespace {
+
+// Noisy plot of a true ENU position, drawn like RadarSimulator::getMeasurements
+Measurement makePlot(uint32_t id, const EnuState& truth, const TrackerConfig& config,
+                     uint64_t scan) {
+    Track track;
+    common::toSpherical(truth, track);
+    CounterRng rng(7, id, scan, CounterRng::Stream::MEASUREMENT);
+    Measurement plot;
+    plot.track_id = id;
+    plot.range_m = track.range_m + config.range_sigma_m * rng.gaussian();
+    plot.azimuth_rad = track.azimuth_rad + config.azimuth_sigma_rad * rng.gaussian();
+    plot.elevation_rad = track.elevation_rad + config.elevation_sigma_rad * rng.gaussian();
+    return plot;
+}
+
+double distance(const Track& track, const EnuState& truth) {
+    const EnuState estimate = common::toEnu(track);
+    const double de = estimate.east_m - truth.east_m;
+    const double dn = estimate.north_m - truth.north_m;
+    const double du = estimate.up_m - truth.up_m;
+    return std::sqrt(de * de + dn * dn + du * du);
+}
+
+double plotDistance(const Measurement& plot, const EnuState& truth) {
+    Track track = {};
+    track.range_m = plot.range_m;
+    track.azimuth_rad = plot.azimuth_rad;
+    track.elevation_rad = plot.elevation_rad;
+    return distance(track, truth);
+}
+
+// RMS position error of the filter over the second half of a run
+// (after settling), alongside the RMS error of the raw plots
+void runTrack(TrackerBank& bank, EnuState truth, double turn_rate_rads, int scans,
+              double& filter_rms_m, double& plot_rms_m) {
+    double filter_sum = 0.0;
+    double plot_sum = 0.0;
+    int counted = 0;
+    for (int scan = 0; scan < scans; ++scan) {
+        std::vector<Measurement> plots = {makePlot(1, truth, bank.getConfig(), scan)};
+        bank.processScan(plots, scan * 0.1);
+        Track estimate = Track();
+        if (!bank.findTrack(1, estimate)) {
+            throw std::runtime_error("Filter exists after its plot");
+        }
+        if (scan >= scans / 2) {
+            const double filter_error = distance(estimate, truth);
+            const double plot_error = plotDistance(plots[0], truth);
+            filter_sum += filter_error * filter_error;
+            plot_sum += plot_error * plot_error;
+            ++counted;
+        }
+        motion::advanceManeuver(truth, 0.0, turn_rate_rads, 0.1);
+        motion::advanceLinear(truth, 0.1);
+    }
+    filter_rms_m = std::sqrt(filter_sum / counted);
+    plot_rms_m = std::sqrt(plot_sum / counted);
+}
+
+} // namespace
+
+// Test: Constant-velocity filter smooths a straight pass
+void test_constant_velocity_smoothing() {
+    std::cout << "  Testing constant-velocity smoothing...\n";
+
+    TrackerBank bank;
+    EnuState truth = {6000.0, 4000.0, 1500.0, -150.0, -100.0, 0.0};
+    double filter_rms_m, plot_rms_m;
+    runTrack(bank, truth, 0.0, 200, filter_rms_m, plot_rms_m);
+    assert(filter_rms_m < 0.6 * plot_rms_m && "Filter beats the raw plots");
+
+    Track estimate = Track();
+    if (!bank.findTrack(1, estimate)) {
+        throw std::runtime_error("Filter exists after the run");
+    }
+    assert(std::fabs(estimate.velocity_ms - std::sqrt(150.0 * 150.0 + 100.0 * 100.0)) < 10.0 &&
+           "Speed recovered from position plots");
+    assert(std::fabs(estimate.elevation_rad) < 0.5 && estimate.range_m > 0.0);
+
+    std::cout << "    ✓ RMS error " << filter_rms_m << "m vs " << plot_rms_m << "m raw\n";
+    std::cout << "  ✓ Constant-velocity smoothing test passed\n";
+}
+
+// Test: Constant-turn filter follows a coordinated turn better than CV
+void test_constant_turn_tracking() {
+    std::cout << "  Testing constant-turn tracking...\n";
+
+    EnuState truth = {3000.0, 5000.0, 800.0, 250.0, 0.0, 0.0};
+    TrackerConfig config;
+    TrackerBank straight(config);
+    config.model = TrackerModel::CONSTANT_TURN;
+    TrackerBank turning(config);
+
+    double cv_rms_m, ct_rms_m, plot_rms_m;
+    runTrack(straight, truth, 0.1, 300, cv_rms_m, plot_rms_m);
+    runTrack(turning, truth, 0.1, 300, ct_rms_m, plot_rms_m);
+    assert(ct_rms_m < cv_rms_m && "Turn model fits a turning target better");
+    assert(ct_rms_m < plot_rms_m && "Turn model beats the raw plots");
+
+    std::cout << "    ✓ RMS error CT " << ct_rms_m << "m, CV " << cv_rms_m
+              << "m, raw " << plot_rms_m << "m\n";
+    std::cout << "  ✓ Constant-turn tracking test passed\n";
+}
+
+// Test: Covariance is symmetric and shrinks below the plot noise
+void test_tracker_covariance() {
+    std::cout << "  Testing tracker covariance...\n";
+
+    TrackerBank bank;
+    EnuState truth = {-5000.0, 2000.0, 1000.0, 120.0, 40.0, 0.0};
+    std::vector<Measurement> plots(1);
+
+    TrackCovariance initial = TrackCovariance();
+    plots[0] = makePlot(1, truth, bank.getConfig(), 0);
+    bank.processScan(plots, 0.0);
+    if (!bank.getCovariance(1, initial)) {
+        throw std::runtime_error("Covariance of a new filter");
+    }
+    assert(initial.matrix[3][3] == 300.0 * 300.0 && "Velocity starts unknown");
+    if (bank.getCovariance(2, initial)) {
+        throw std::runtime_error("Unknown id has no covariance");
+    }
+
+    for (int scan = 1; scan < 100; ++scan) {
+        motion::advanceLinear(truth, 0.1);
+        plots[0] = makePlot(1, truth, bank.getConfig(), scan);
+        bank.processScan(plots, scan * 0.1);
+    }
+    TrackCovariance settled = TrackCovariance();
+    if (!bank.getCovariance(1, settled)) {
+        throw std::runtime_error("Covariance after settling");
+    }
+    for (int r = 0; r < 6; ++r) {
+        assert(settled.matrix[r][r] > 0.0 && "Positive variances");
+        for (int c = 0; c < 6; ++c) {
+            assert(std::fabs(settled.matrix[r][c] - settled.matrix[c][r]) <=
+                   1e-9 * std::fabs(settled.matrix[r][r] + settled.matrix[c][c]) && "Symmetric");
+        }
+    }
+    for (int r = 0; r < 3; ++r) {
+        assert(settled.matrix[r][r] < initial.matrix[r][r] && "Position variance shrinks");
+        assert(settled.matrix[3 + r][3 + r] < 100.0 && "Velocity variance settles");
+    }
+
+    std::cout << "  ✓ Tracker covariance test passed\n";
+}
+
+// Test: Filters without plots coast, then drop; ids route plots
+void test_tracker_coasting() {
+    std::cout << "  Testing tracker coasting...\n";
+
+    TrackerConfig config;
+    config.max_coast_scans = 3;
+    TrackerBank bank(config);
+    EnuState first = {4000.0, 0.0, 500.0, 0.0, 200.0, 0.0};
+    EnuState second = {0.0, 7000.0, 500.0, 100.0, -100.0, 0.0};
+
+    std::vector<Measurement> plots = {makePlot(10, first, config, 0),
+                                      makePlot(20, second, config, 0)};
+    bank.processScan(plots, 0.0);
+    assert(bank.size() == 2 && bank.getTracks().size() == 2 && "One filter per id");
+
+    // Only the second track keeps reporting
+    for (int scan = 1; scan <= 4; ++scan) {
+        motion::advanceLinear(second, 0.1);
+        plots = {makePlot(20, second, config, scan)};
+        bank.processScan(plots, scan * 0.1);
+        Track coasting;
+        if (bank.findTrack(10, coasting) != (scan <= 3)) {
+            throw std::runtime_error("Dropped after max_coast_scans");
+        }
+    }
+    assert(bank.size() == 1 && bank.getTracks()[0].id == 20 && "Reporting filter kept");
+
+    bank.clear();
+    assert(bank.size() == 0 && bank.getTracks().empty() && "Clear removes every filter");
+
+    std::cout << "  ✓ Tracker coasting test passed\n";
+}
+
+// Test: Vector kernels match the scalar reference
+void test_tracker_kernel_isa() {
+    std::cout << "  Testing tracker kernel instruction sets...\n";
+
+    const common::KernelIsa best = common::detectKernelIsa();
+    TrackerConfig config;
+    config.model = TrackerModel::CONSTANT_TURN;
+
+    std::vector<TrackerBank> banks;
+    const common::KernelIsa isas[] = {common::KernelIsa::SCALAR, common::KernelIsa::SSE41,
+                                      common::KernelIsa::AVX2};
+    for (common::KernelIsa isa : isas) {
+        common::setKernelIsa(isa);
+        TrackerBank bank(config);
+
+        // 11 tracks: exercises full vectors and the scalar remainder
+        std::vector<Measurement> plots(11);
+        for (int scan = 0; scan < 30; ++scan) {
+            for (uint32_t id = 0; id < plots.size(); ++id) {
+                EnuState truth = {1000.0 * id, 8000.0, 300.0 + id, 0.0, -200.0, 0.0};
+                motion::advanceManeuver(truth, 0.0, 0.02 * scan, 0.1);
+                motion::advanceLinear(truth, 0.1 * scan);
+                plots[id] = makePlot(id + 1, truth, config, scan);  // Id 0 is a false alarm
+            }
+            bank.processScan(plots, scan * 0.1);
+        }
+        banks.push_back(bank);
+    }
+    common::setKernelIsa(best);
+
+    for (size_t b = 1; b < banks.size(); ++b) {
+        for (uint32_t id = 0; id < 11; ++id) {
+            Track reference = Track();
+            Track vector = Track();
+            if (!banks[0].findTrack(id + 1, reference) || !banks[b].findTrack(id + 1, vector)) {
+                throw std::runtime_error("Every id tracked on every ISA");
+            }
+            assert(std::fabs(reference.range_m - vector.range_m) < 1e-6);
+            assert(std::fabs(reference.azimuth_rad - vector.azimuth_rad) < 1e-9);
+            assert(std::fabs(reference.velocity_ms - vector.velocity_ms) < 1e-6);
+        }
+    }
+
+    std::cout << "    ✓ Best kernel: " << common::kernelIsaName(best) << "\n";
+    std::cout << "  ✓ Tracker kernel instruction set test passed\n";
+}
+
+// Test: Thousands of simulator tracks per 100 ms scan on one core
+void test_tracker_throughput() {
+    std::cout << "  Testing tracker throughput...\n";
+
+    ScenarioConfig config;
+    config.target_count = 5000;
+    config.detection_zone_radius_m = 1.0e7;
+    config.min_elevation_rad = -1.6;
+    config.max_elevation_rad = 1.6;
+    RadarSimulator radar;
+    radar.setRandomSeed(21);
+    radar.setScenario(ScenarioType::MASS_RAID, config);
+
+    TrackerConfig tracker_config;
+    tracker_config.model = TrackerModel::CONSTANT_TURN;
+    TrackerBank bank(tracker_config);
+    std::vector<Measurement> plots;
+    double worst_ms = 0.0;
+    for (int scan = 0; scan < 20; ++scan) {
+        radar.updateTracks(0.1);
+        radar.getMeasurements(plots);
+        assert(plots.size() == radar.getActiveTrackCount() && "One plot per active track");
+
+        auto start = std::chrono::steady_clock::now();
+        bank.processScan(plots, scan * 0.1);
+        auto end = std::chrono::steady_clock::now();
+        worst_ms = std::max(worst_ms,
+                            std::chrono::duration<double, std::milli>(end - start).count());
+        assert(bank.size() >= plots.size() && "Every reporting track has a filter");
+    }
+    assert(worst_ms < 100.0 && "Scan fits the 100 ms cycle");
+
+    // Same cycle, same plots: the noise is keyed, not drawn from shared state
+    std::vector<Measurement> again;
+    radar.getMeasurements(again);
+    assert(again.size() == plots.size() && again[0].range_m == plots[0].range_m);
+
+    std::cout << "    ✓ " << plots.size() << " tracks, worst scan " << worst_ms << "ms\n";
+    std::cout << "  ✓ Tracker throughput test passed\n";
+}
+
+int main() {
+    std::cout << "Running tracker bank tests...\n";
+
+    try {
+        test_constant_velocity_smoothing();
+        test_constant_turn_tracking();
+        test_tracker_covariance();
+        test_tracker_coasting();
+        test_tracker_kernel_isa();
+        test_tracker_throughput();
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All tracker bank tests passed!\n";
+    return 0;
+}